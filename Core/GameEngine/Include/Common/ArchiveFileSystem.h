@@ -144,6 +144,47 @@ public:
 };
 
 
+//===============================
+// ArchivedFileIndex
+//===============================
+/**
+	* TheSuperHackers @performance alanblack166 18/10/2026 Open addressing hash table from the full path of an archived file
+	* to the name of the archive file that provides it. The paths are turned into keys the same way
+	* that the directory tree lookups split them, so both always find the same archive file.
+	*/
+//===============================
+class ArchivedFileIndex
+{
+public:
+	enum { MAX_KEY_LENGTH = 1024 };
+
+	ArchivedFileIndex();
+
+	void clear();
+	void insert(const char *key, Int keyLength, const AsciiString& archiveFilename, Bool overwrite);
+	const AsciiString* find(const char *key, Int keyLength) const;
+	Int getCount() const { return m_count; }
+
+	/// Writes the lowercase key of the given path and returns its length. Returns 0 for paths
+	/// that cannot name an archived file and -1 for paths longer than MAX_KEY_LENGTH.
+	static Int makeKey(const char *path, char *key);
+
+private:
+	struct Entry
+	{
+		UnsignedInt hash;
+		AsciiString key;
+		AsciiString archiveFilename;
+	};
+
+	static UnsignedInt hashKey(const char *key, Int keyLength);
+	Int findSlot(const char *key, Int keyLength, UnsignedInt hash) const;
+	void grow();
+
+	std::vector<Entry> m_entries;	///< size is zero or a power of two
+	Int m_count;
+};
+
 class ArchiveFileSystem : public SubsystemInterface
 {
 	public:
@@ -172,13 +213,24 @@ class ArchiveFileSystem : public SubsystemInterface
 
 	// Unprotected this for copy-protection routines
 	AsciiString						getArchiveFilenameForFile(const AsciiString& filename) const;
+	Bool									getArchivedFileLocation(const AsciiString& filename, AsciiString *archiveFilename, UnsignedInt *offset, UnsignedInt *size) const; ///< return the archive file that provides the file, and the offset and the size of the file in it
 	void loadMods( void );
 
+	Int benchmarkOpenAllFiles( void );	///< open every file in every archive file and print the timings, returns an exit code
+
+	UnsignedInt getLookupCount( void ) const { return m_lookupCount; }	///< number of file lookups since the last resetLookupCount
+	void resetLookupCount( void ) { m_lookupCount = 0; }
+
 protected:
 	virtual void					loadIntoDirectoryTree(const ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite = FALSE );	///< load the archive file's header information and apply it to the global archive directory tree.
 
+	const AsciiString&		lookupArchiveFilename(const Char *filename) const;
+	const AsciiString&		getArchiveFilenameFromTree(const AsciiString& filename) const;
+
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+	ArchivedFileIndex m_fileIndex;	///< index of the files in m_rootDirectory by their full path
+	mutable UnsignedInt m_lookupCount;
 };
 
 
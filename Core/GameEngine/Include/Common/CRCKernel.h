@@ -0,0 +1,51 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Lib/BaseType.h"
+
+// TheSuperHackers @performance alanblack166 18/10/2026 The loops of the game CRCs. Both CRC and XferCRC rotate the CRC left by
+// one bit and add the next value to it. The carry of each addition flows into the next step, so the
+// steps can neither be split over SIMD lanes nor be looked up in tables without changing the values.
+// Instead addBytes hashes 8 bytes at once whenever it can prove that no carry crosses the top bit
+// within them, and the other loops keep the step chain as short as possible. All of them produce
+// exactly the values of the original loops.
+class CRCKernel
+{
+public:
+
+	/// Adds the bytes to the CRC, the same as the loop of CRC::computeCRC.
+	static UnsignedInt addBytes(UnsignedInt crc, const UnsignedByte *bytes, Int count);
+
+	/// Adds the words in big endian order to the CRC, the same as the word loop of XferCRC.
+	static UnsignedInt addBigEndianWords(UnsignedInt crc, const UnsignedInt *words, Int count);
+
+	/// Adds the values as they are to the CRC, for values that XferCRC already converted.
+	static UnsignedInt addValues(UnsignedInt crc, const UnsignedInt *values, Int count);
+
+	/// Measures the throughput of the kernels against the original loops, prints it and checks that
+	/// both produce the same values. Returns an exit code.
+	static Int benchmark();
+
+	static inline UnsignedInt addValue(UnsignedInt crc, UnsignedInt value)
+	{
+		// same as (crc << 1) + value + ((crc >> 31) & 1), but compiles to a rotate and an add
+		return ((crc << 1) | (crc >> 31)) + value;
+	}
+};
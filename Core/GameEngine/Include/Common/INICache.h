@@ -0,0 +1,73 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @performance alanblack166 18/10/2026 Binary cache of the lines that INI::readLine produces for each INI file.
+// INI::load replays the cached lines instead of cleaning up the text of the file character by character.
+// An entry is only used while the file still comes from the same place with the same size and time stamp,
+// which costs a file info lookup instead of a pass over the text. The replayed lines are byte for byte
+// the lines of the text, so the parsed data and the INI CRC stay identical.
+class INICache
+{
+public:
+
+	struct Source
+	{
+		AsciiString archiveFilename;	///< archive file that provides the file, empty for a local file
+		UnsignedInt archiveOffset;		///< offset of the file in its archive file
+		UnsignedInt size;
+		Int timestampHigh;						///< time stamp of the local file or of its archive file
+		Int timestampLow;
+
+		Source() : archiveOffset(0), size(0), timestampHigh(0), timestampLow(0) {}
+		Bool operator==(const Source &other) const;
+	};
+
+	struct Entry
+	{
+		Source source;
+		std::vector<char> lines; ///< Each line is stored as its UnsignedShort length followed by its characters
+	};
+
+	INICache();
+	~INICache();
+
+	Bool load(const AsciiString &filename);
+	Bool save();
+
+	const Entry *find(const AsciiString &sourceFilename, const Source &source) const;
+	void store(const AsciiString &sourceFilename, const Source &source, const std::vector<char> &lines);
+
+	static Bool getSource(const AsciiString &sourceFilename, Source *source);
+
+	UnsignedInt getHits() const { return m_hits; }
+	UnsignedInt getMisses() const { return m_misses; }
+
+private:
+
+	typedef std::map<AsciiString, Entry> EntryMap;
+
+	EntryMap m_entries;
+	AsciiString m_filename;
+	Bool m_dirty;
+	mutable UnsignedInt m_hits;
+	mutable UnsignedInt m_misses;
+};
+
+extern INICache *TheINICache;
@@ -0,0 +1,105 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class CriticalSectionClass;
+class INIPrefetchThread;
+class StartupTimeline;
+
+// TheSuperHackers @performance alanblack166 18/10/2026 Reads the INI files of the startup and splits them into lines on worker
+// threads, while the main thread parses the files that are already split. The file systems are not thread
+// safe, so the main thread only looks up where each file is, either a local file or a range in an archive
+// file, and the workers read that with a file of their own. INI::load then takes the lines of its file
+// from here and replays them, in the same order as always, so the parsed data and the INI CRC do not change.
+class INIPrefetcher
+{
+public:
+
+	/// Turns the text of an INI file into the lines that INI::readLine produces for it,
+	/// in the line format of the INI cache. Runs on the worker threads.
+	typedef void (*TokenizeProc)(const char *filename, const char *text, Int size, std::vector<char> &lines);
+
+	INIPrefetcher(TokenizeProc tokenizeProc);
+	~INIPrefetcher();
+
+	/// Queues all INI files in the directory and its subdirectories.
+	void addDirectory(const AsciiString &path);
+	void addFile(const AsciiString &filename);
+
+	/// Tells the worker threads that no more files are queued, so they stop once they are idle.
+	void finishQueue();
+
+	/// Hands out the lines of a queued file, waiting for them if necessary. Each file is handed
+	/// out once. Returns FALSE if the file was not queued, which means it is read as usual.
+	Bool takeLines(const AsciiString &filename, std::vector<char> &lines);
+
+	void addCounters(StartupTimeline *timeline) const;
+
+private:
+
+	friend class INIPrefetchThread;
+
+	enum JobState
+	{
+		JOB_QUEUED,
+		JOB_RUNNING,
+		JOB_DONE
+	};
+
+	struct Job
+	{
+		AsciiString filename;
+		AsciiString diskFilename; ///< The local file, or the archive file that provides the file
+		Int access;
+		UnsignedInt offset;
+		Int size; ///< -1 to read the whole local file
+		std::vector<char> lines;
+		JobState state;
+		Bool failed; ///< The file could not be read, so INI::load reads it as usual
+	};
+
+	typedef std::map<AsciiString, Job *> JobMap;
+
+	static AsciiString makeKey(const AsciiString &filename);
+
+	Bool runNextJob(); ///< Called by the worker threads, returns FALSE when there is no queued job left
+	Bool isQueueFinished() const;
+	void runJob(Job *job);
+	static Bool readText(const Job *job, std::vector<char> &text);
+
+	TokenizeProc m_tokenizeProc;
+	CriticalSectionClass *m_lock;
+	std::vector<INIPrefetchThread *> m_threads;
+
+	std::vector<Job *> m_jobs; ///< Jobs in the order they are queued, guarded by m_lock
+	JobMap m_jobsByName; ///< Only used by the main thread
+	size_t m_nextJob; ///< Guarded by m_lock
+	Bool m_queueFinished; ///< Guarded by m_lock
+
+	Int64 m_ticksPerSecond;
+	Int64 m_queueTicks;
+	Int64 m_waitTicks;
+	Int64 m_readTicks; ///< Guarded by m_lock
+	Int64 m_tokenizeTicks; ///< Guarded by m_lock
+	UnsignedInt m_bytesRead; ///< Guarded by m_lock
+	UnsignedInt m_filesTaken;
+	UnsignedInt m_filesTokenizedByMainThread;
+};
+
+extern INIPrefetcher *TheINIPrefetcher;
@@ -0,0 +1,154 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @feature alanblack166 18/10/2026 Attributes the time of each logic frame to the update module classes
+// and the partition manager queries that ran in it, and writes it to a per frame CSV file or to a
+// Chrome trace JSON file (chrome://tracing, ui.perfetto.dev). Unlike the PerfGather timers, it
+// does not need to be compiled in.
+class LogicProfiler
+{
+public:
+
+	enum OutputFormat
+	{
+		OUTPUT_CSV,
+		OUTPUT_CHROME_TRACE
+	};
+
+	LogicProfiler();
+	~LogicProfiler();
+
+	// Files ending with .json are written as Chrome trace, all others as CSV.
+	Bool open(const AsciiString &filename);
+	void close();
+
+	void beginReplay(const AsciiString &name);
+	void beginFrame(UnsignedInt frame);
+	void endFrame();
+
+	// Scopes are named either by a static string or by the name key of a module class.
+	void beginScope(const char *name);
+	void beginScope(NameKeyType moduleNameKey);
+	void endScope();
+
+private:
+
+	struct ScopeStats
+	{
+		AsciiString name;
+		UnsignedInt frameCalls;
+		Int64 frameTotalTicks;
+		Int64 frameSelfTicks;
+		Bool usedThisFrame;
+	};
+
+	struct ActiveScope
+	{
+		Int slot;
+		Int64 startTicks;
+		Int64 childTicks;
+	};
+
+	typedef std::map<const char *, Int> StaticNameSlotMap;
+	typedef std::map<NameKeyType, Int> NameKeySlotMap;
+
+	Int getSlot(const char *name);
+	Int getSlot(NameKeyType moduleNameKey);
+	Int addSlot(const AsciiString &name);
+	void pushScope(Int slot);
+
+	void writeFrameCSV();
+	void writeFrameChromeTrace();
+	void writeChromeTraceEventSeparator();
+	static void writeJSONString(FILE *file, const char *str);
+
+	Int64 getTicks() const;
+	double ticksToMicroseconds(Int64 ticks) const;
+
+	FILE *m_file;
+	OutputFormat m_format;
+	Int64 m_ticksPerSecond;
+	Int64 m_openTicks;
+	Int64 m_frameStartTicks;
+	UnsignedInt m_frame;
+	UnsignedInt m_replayIndex;
+	Bool m_inFrame;
+	Bool m_firstTraceEvent;
+
+	std::vector<ScopeStats> m_scopes;
+	std::vector<Int> m_frameSlots; ///< Slots that were used in the current frame
+	std::vector<ActiveScope> m_activeScopes;
+	StaticNameSlotMap m_staticNameSlots;
+	NameKeySlotMap m_nameKeySlots;
+};
+
+extern LogicProfiler *TheLogicProfiler;
+
+// ------------------------------------------------------------------------------------------------
+class LogicProfilerScope
+{
+public:
+	LogicProfilerScope(const char *name) : m_active(TheLogicProfiler != NULL)
+	{
+		if (m_active)
+			TheLogicProfiler->beginScope(name);
+	}
+
+	LogicProfilerScope(NameKeyType moduleNameKey) : m_active(TheLogicProfiler != NULL)
+	{
+		if (m_active)
+			TheLogicProfiler->beginScope(moduleNameKey);
+	}
+
+	~LogicProfilerScope()
+	{
+		if (m_active)
+			TheLogicProfiler->endScope();
+	}
+
+private:
+	Bool m_active;
+};
+
+// ------------------------------------------------------------------------------------------------
+class LogicProfilerFrame
+{
+public:
+	LogicProfilerFrame(UnsignedInt frame) : m_active(TheLogicProfiler != NULL)
+	{
+		if (m_active)
+			TheLogicProfiler->beginFrame(frame);
+	}
+
+	~LogicProfilerFrame()
+	{
+		if (m_active)
+			TheLogicProfiler->endFrame();
+	}
+
+private:
+	Bool m_active;
+};
+
+// Profile the rest of the enclosing block under the given static name.
+#define LOGIC_PROFILE_SCOPE(id) LogicProfilerScope lps_##id(#id);
+// Profile the rest of the enclosing block under the class name of the given module.
+// The module name is only looked up while the profiler is active.
+#define LOGIC_PROFILE_MODULE(module) LogicProfilerScope lpsModule(TheLogicProfiler ? (module)->getModuleNameKey() : NAMEKEY_INVALID);
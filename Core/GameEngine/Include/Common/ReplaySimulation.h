@@ -26,7 +26,10 @@ public:
 	// Simulate a list of replays without graphics.
 	// Returns exit code 1 if mismatch or other error occurred
 	// Returns exit code 0 if all replays were successfully simulated without mismatches
-	static int simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses);
+	// TheSuperHackers @performance alanblack166 18/10/2026 Each worker process simulates up to replaysPerProcess replays,
+	// so that the engine is initialized once per batch instead of once per replay.
+	// If summaryFilename is not empty, the throughput and the result of each replay is written to it.
+	static int simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess, const AsciiString &summaryFilename);
 
 	static void stop() { s_isRunning = false; }
 
@@ -36,10 +39,26 @@ public:
 
 private:
 
-	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames);
-	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses);
+	struct ReplayResult
+	{
+		ReplayResult() : logicFrames(0), wallTimeMillis(0), success(false) {}
+
+		AsciiString filename;
+		UnsignedInt logicFrames;
+		UnsignedInt wallTimeMillis;
+		Bool success;
+	};
+	typedef std::vector<ReplayResult> ReplayResults;
+
+	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames, ReplayResults &results);
+	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess, ReplayResults &results);
 	static std::vector<AsciiString> resolveFilenameWildcards(const std::vector<AsciiString> &filenames);
 
+	static void resimulateFromCheckpoint();
+	static void printReplayResult(const ReplayResult &result);
+	static void parseReplayResults(const AsciiString &stdOutput, ReplayResults &results, size_t count, Bool exitedWithSuccess);
+	static void writeSummary(const AsciiString &summaryFilename, const ReplayResults &results, UnsignedInt totalWallTimeMillis, int maxProcesses);
+
 private:
 
 	static Bool s_isRunning;
@@ -0,0 +1,112 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @feature alanblack166 18/10/2026 Counts how often the conditions and actions of every map script, script group,
+// team script and AI script ran in a game and how long they took, and writes them at the end of the game
+// sorted by their total time, to a CSV file and to the debug log. The times of a script include the
+// subroutines its actions run.
+class ScriptProfiler
+{
+public:
+
+	enum Phase
+	{
+		PHASE_CONDITIONS,
+		PHASE_ACTIONS,
+		PHASE_GROUP, ///< All scripts of a script group
+
+		PHASE_COUNT
+	};
+
+	ScriptProfiler();
+	~ScriptProfiler();
+
+	Bool open(const AsciiString &filename);
+	void close();
+
+	/// Starts the statistics of a new game on the given map.
+	void beginGame(const AsciiString &mapName);
+	/// Writes the statistics of the current game, if there are any, and clears them.
+	void endGame();
+
+	/// Returns the slot of the script, which is only identified by its address during a game.
+	/// The kind and name are only used when the script is seen first.
+	Int getSlot(const void *script, const char *kind, const AsciiString &name);
+
+	void addTime(Int slot, Phase phase, Int64 ticks);
+
+	Int64 getTicks() const;
+
+private:
+
+	struct ScriptStats
+	{
+		const char *kind;
+		AsciiString name;
+		UnsignedInt count[PHASE_COUNT];
+		Int64 ticks[PHASE_COUNT];
+	};
+
+	typedef std::map<const void *, Int> ScriptSlotMap;
+
+	struct SlowerScript;
+	friend struct SlowerScript;
+
+	Int64 getTotalTicks(const ScriptStats &stats) const;
+	double ticksToMilliseconds(Int64 ticks) const;
+	static void writeCSVString(FILE *file, const AsciiString &str);
+
+	FILE *m_file;
+	Int64 m_ticksPerSecond;
+	UnsignedInt m_gameIndex;
+	AsciiString m_mapName;
+
+	std::vector<ScriptStats> m_scripts;
+	ScriptSlotMap m_slots;
+};
+
+extern ScriptProfiler *TheScriptProfiler;
+
+// ------------------------------------------------------------------------------------------------
+class ScriptProfilerScope
+{
+public:
+	ScriptProfilerScope(Int slot, ScriptProfiler::Phase phase) : m_slot(slot), m_phase(phase), m_startTicks(0)
+	{
+		if (m_slot >= 0)
+			m_startTicks = TheScriptProfiler->getTicks();
+	}
+
+	~ScriptProfilerScope()
+	{
+		if (m_slot >= 0)
+			TheScriptProfiler->addTime(m_slot, m_phase, TheScriptProfiler->getTicks() - m_startTicks);
+	}
+
+private:
+	Int m_slot;
+	ScriptProfiler::Phase m_phase;
+	Int64 m_startTicks;
+};
+
+// Profile the rest of the enclosing block as the given phase of the script. The kind and the name of
+// the script are only evaluated while the profiler is active.
+#define SCRIPT_PROFILE_SCOPE(id, script, kind, name, phase) \
+	ScriptProfilerScope sps_##id(TheScriptProfiler ? TheScriptProfiler->getSlot((script), (kind), (name)) : -1, (phase));
@@ -0,0 +1,80 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @performance alanblack166 18/10/2026 Records where the time of GameEngine::init goes. The init is split into
+// phases by mark(), and each subsystem started by initSubsystem is recorded with the time of its init()
+// and of its INI files. report() writes all of it to the debug log in one table, and optionally to a
+// CSV file. This replaces the DUMP_PERF_STATS timing lines of GameEngine::init.
+class StartupTimeline
+{
+public:
+
+	StartupTimeline();
+
+	/// Ends the current phase of the startup with the given name and begins the next one.
+	void mark(const char *phase);
+
+	void beginSubsystem(const AsciiString &name);
+	void endSubsystemInit(); ///< The subsystem init() is done, its INI files are loaded next
+	void endSubsystem();
+
+	/// Adds a named value that is listed below the phases, for example the statistics of a loader.
+	void addCounter(const char *name, double value);
+
+	/// Writes the timeline to the debug log, and to a CSV file when a filename is given.
+	void report(const AsciiString &filename) const;
+
+private:
+
+	struct Phase
+	{
+		AsciiString name;
+		Int64 startTicks;
+		Int64 endTicks;
+	};
+
+	struct Subsystem
+	{
+		AsciiString name;
+		Int64 startTicks;
+		Int64 initEndTicks;
+		Int64 endTicks;
+	};
+
+	struct Counter
+	{
+		AsciiString name;
+		double value;
+	};
+
+	Int64 getTicks() const;
+	double ticksToSeconds(Int64 ticks) const;
+
+	Int64 m_ticksPerSecond;
+	Int64 m_startTicks;
+	Int64 m_phaseStartTicks;
+	Int m_openSubsystem; ///< Index of the subsystem that is being initialized, or -1
+
+	std::vector<Phase> m_phases;
+	std::vector<Subsystem> m_subsystems;
+	std::vector<Counter> m_counters;
+};
+
+extern StartupTimeline *TheStartupTimeline;
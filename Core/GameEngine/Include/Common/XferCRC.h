@@ -37,6 +37,7 @@
 
 // FORWARD REFERENCES /////////////////////////////////////////////////////////////////////////////
 class Snapshot;
+class XferCRCSegmentCache;
 
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
@@ -68,6 +69,49 @@ protected:
 
 	UnsignedInt m_crc;
 
+	friend class XferCRCSegmentCache;
+
+};
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance alanblack166 18/10/2026 Caches the CRC input of a large, mostly unchanging part of the
+	* logic state, such as the partition cells. The part is split into segments, and the owner marks
+	* the segments whose data changes. The CRC mixes each value into the running CRC of everything
+	* before it, so a segment cannot keep its own CRC. Instead the cache keeps the values that
+	* a segment adds to the CRC, and adds them again in a tight loop while the segment is unchanged.
+	* Changed segments are walked through their snapshots as usual. The resulting CRC is the same
+	* as that of the full walk, which debug builds verify on every call. */
+//-------------------------------------------------------------------------------------------------
+class XferCRCSegmentCache
+{
+
+public:
+
+	/// CRCs the data of one segment, by calling crc() or xfer methods on the given xfer.
+	typedef void (*SegmentProc)( Xfer *xfer, Int segment, void *userData );
+
+	XferCRCSegmentCache( void ) { }
+
+	void reset( Int segmentCount );									///< forget all cached data, all segments are dirty
+	void markDirty( Int segment ) { m_segments[ segment ].dirty = TRUE; }
+	void markAllDirty( void );
+	Int getSegmentCount( void ) const { return (Int)m_segments.size(); }
+
+	/// CRCs all segments in order, equal to calling proc for every segment on xfer.
+	void crc( XferCRC *xfer, SegmentProc proc, void *userData );
+
+private:
+
+	struct Segment
+	{
+		std::vector<UnsignedInt> values;		///< the values the segment adds to the CRC, in order
+		UnsignedInt crcBefore;							///< running CRC before the segment, when it was last added
+		UnsignedInt crcAfter;								///< running CRC after the segment, when it was last added
+		Bool dirty;
+	};
+
+	std::vector<Segment> m_segments;
+
 };
 
 #endif // __XFERDISKWRITE_H_
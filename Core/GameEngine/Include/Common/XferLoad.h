@@ -50,6 +50,7 @@ public:
 	virtual ~XferLoad( void );
 
 	virtual void open( AsciiString identifier );				///< open file for writing
+	void openBuffer( AsciiString identifier, const UnsignedByte *data, UnsignedInt dataSize );	///< open memory buffer for reading
 	virtual void close( void );													///< close file
 	virtual Int beginBlock( void );														///< read placeholder block size
 	virtual void endBlock( void );											///< reading an end block is a no-op
@@ -65,7 +66,14 @@ protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
 
+	Bool isOpen( void ) const { return m_fileFP != NULL || m_bufferData != NULL; }
+	Bool read( void *data, Int dataSize );							///< read data from the current position
+
 	FILE * m_fileFP;																					///< pointer to file
+	const UnsignedByte *m_bufferData;													///< memory buffer, used instead of a file
+	UnsignedInt m_bufferSize;																	///< size of memory buffer
+	UnsignedInt m_bufferPos;																	///< read position in memory buffer
+	std::vector<UnsignedByte> m_fileData;											///< decompressed contents of a compressed file
 
 };
 
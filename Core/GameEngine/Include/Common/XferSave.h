@@ -34,6 +34,7 @@
 
 // USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
 #include "Common/Xfer.h"
+#include "Compression.h"
 
 // FORWARD REFERENCES /////////////////////////////////////////////////////////////////////////////
 class XferBlockData;
@@ -54,6 +55,10 @@ public:
 
 	// Xfer methods
 	virtual void open( AsciiString identifier );		///< open file for writing
+	void openBuffer( AsciiString identifier, std::vector<UnsignedByte> *buffer );	///< open memory buffer for writing
+	void setCompression( CompressionType compType ) { m_compression = compType; }	///< compress the next file opened, see open()
+	static void waitForPendingWrites( void );				///< wait until the background thread has written all compressed files
+	static Bool takeWriteError( AsciiString *filename );	///< return the compressed file that could not be written, see waitForPendingWrites
 	virtual void close( void );											///< close file
 	virtual Int beginBlock( void );									///< write placeholder block size
 	virtual void endBlock( void );									///< backup to last begin block and write size
@@ -69,8 +74,18 @@ protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
 
+	Bool isOpen( void ) const { return m_fileFP != NULL || m_buffer != NULL; }
+	XferFilePos tell( void ) const;												///< current write position
+	void seek( XferFilePos pos );													///< set current write position
+	Bool write( const void *data, Int dataSize );					///< write data at the current position
+
 	FILE * m_fileFP;																			///< pointer to file
+	std::vector<UnsignedByte> *m_buffer;									///< memory buffer, used instead of a file
+	XferFilePos m_bufferPos;															///< write position in memory buffer
 	XferBlockData *m_blockStack;													///< stack of block data
+	CompressionType m_compression;												///< compression of the file, COMPRESSION_NONE writes it directly
+	std::vector<UnsignedByte> m_fileData;									///< contents of a compressed file, until close hands them to the writer thread
+	Int64 m_openTicks;																		///< performance counter at open, to log the time the main thread spent
 
 };
 
@@ -0,0 +1,275 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/INICache.h"
+#include "Common/ArchiveFileSystem.h"
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/LocalFileSystem.h"
+#include "Common/XferCRC.h"
+
+INICache *TheINICache = NULL;
+
+static const char INICacheIdentifier[4] = { 'I', 'N', 'I', 'C' };
+static const UnsignedInt INICacheVersion = 2;
+
+//-------------------------------------------------------------------------------------------------
+static void appendToBuffer(std::vector<char> &buffer, const void *data, Int size)
+{
+	const char *bytes = (const char *)data;
+	buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool readFromBuffer(const std::vector<char> &buffer, size_t &pos, void *data, size_t size)
+{
+	if (size > buffer.size() - pos)
+		return FALSE;
+	if (size > 0)
+		memcpy(data, &buffer[pos], size);
+	pos += size;
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt computeCRC(const void *data, Int size)
+{
+	XferCRC xferCRC;
+	xferCRC.open("INICache");
+	xferCRC.xferUser(const_cast<void *>(data), size);
+	xferCRC.close();
+	return xferCRC.getCRC();
+}
+
+//-------------------------------------------------------------------------------------------------
+static void appendString(std::vector<char> &buffer, const AsciiString &str)
+{
+	const UnsignedInt length = str.getLength();
+	appendToBuffer(buffer, &length, sizeof(length));
+	appendToBuffer(buffer, str.str(), length);
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool readString(const std::vector<char> &buffer, size_t &pos, AsciiString &str)
+{
+	UnsignedInt length = 0;
+	if (!readFromBuffer(buffer, pos, &length, sizeof(length)) || length > buffer.size() - pos)
+		return FALSE;
+
+	char *chars = str.getBufferForRead(length + 1);
+	readFromBuffer(buffer, pos, chars, length);
+	chars[length] = 0;
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INICache::Source::operator==(const Source &other) const
+{
+	return size == other.size
+		&& timestampHigh == other.timestampHigh
+		&& timestampLow == other.timestampLow
+		&& archiveOffset == other.archiveOffset
+		&& archiveFilename.compareNoCase(other.archiveFilename) == 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+INICache::INICache() :
+	m_dirty(FALSE),
+	m_hits(0),
+	m_misses(0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+INICache::~INICache()
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Reads the cache file. A missing, outdated or damaged cache file leaves the cache empty,
+	* so that it is written again from the INI files that are loaded next. */
+//-------------------------------------------------------------------------------------------------
+Bool INICache::load(const AsciiString &filename)
+{
+	m_filename = filename;
+	m_entries.clear();
+	m_dirty = FALSE;
+
+	File *file = TheLocalFileSystem->openFile(filename.str(), File::READ | File::BINARY);
+	if (file == NULL)
+		return FALSE;
+
+	std::vector<char> buffer(file->size());
+	const Bool readAll = buffer.empty() || file->read(&buffer[0], (Int)buffer.size()) == (Int)buffer.size();
+	file->close();
+	if (!readAll)
+		return FALSE;
+
+	// the last 4 bytes are the CRC of everything before them.
+	UnsignedInt fileCRC = 0;
+	if (buffer.size() < sizeof(INICacheIdentifier) + 3 * sizeof(UnsignedInt))
+		return FALSE;
+	const size_t dataSize = buffer.size() - sizeof(UnsignedInt);
+	memcpy(&fileCRC, &buffer[dataSize], sizeof(UnsignedInt));
+	if (fileCRC != computeCRC(&buffer[0], (Int)dataSize))
+	{
+		DEBUG_LOG(("INICache::load - %s is damaged, ignoring it", filename.str()));
+		return FALSE;
+	}
+	buffer.resize(dataSize);
+
+	size_t pos = 0;
+	char identifier[sizeof(INICacheIdentifier)];
+	UnsignedInt version = 0;
+	UnsignedInt numEntries = 0;
+	if (!readFromBuffer(buffer, pos, identifier, sizeof(identifier))
+		|| memcmp(identifier, INICacheIdentifier, sizeof(identifier)) != 0
+		|| !readFromBuffer(buffer, pos, &version, sizeof(version))
+		|| version != INICacheVersion
+		|| !readFromBuffer(buffer, pos, &numEntries, sizeof(numEntries)))
+	{
+		return FALSE;
+	}
+
+	for (UnsignedInt i = 0; i < numEntries; ++i)
+	{
+		UnsignedInt linesSize = 0;
+		AsciiString sourceFilename;
+		Entry entry;
+		if (!readString(buffer, pos, sourceFilename)
+			|| !readString(buffer, pos, entry.source.archiveFilename)
+			|| !readFromBuffer(buffer, pos, &entry.source.archiveOffset, sizeof(entry.source.archiveOffset))
+			|| !readFromBuffer(buffer, pos, &entry.source.size, sizeof(entry.source.size))
+			|| !readFromBuffer(buffer, pos, &entry.source.timestampHigh, sizeof(entry.source.timestampHigh))
+			|| !readFromBuffer(buffer, pos, &entry.source.timestampLow, sizeof(entry.source.timestampLow))
+			|| !readFromBuffer(buffer, pos, &linesSize, sizeof(linesSize))
+			|| linesSize > buffer.size() - pos)
+		{
+			m_entries.clear();
+			return FALSE;
+		}
+
+		entry.lines.assign(buffer.begin() + pos, buffer.begin() + pos + linesSize);
+		pos += linesSize;
+		m_entries[sourceFilename] = entry;
+	}
+
+	DEBUG_LOG(("INICache::load - loaded %u cached INI files from %s", numEntries, filename.str()));
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INICache::save()
+{
+	if (!m_dirty || m_filename.isEmpty())
+		return TRUE;
+
+	std::vector<char> buffer;
+	const UnsignedInt numEntries = (UnsignedInt)m_entries.size();
+	appendToBuffer(buffer, INICacheIdentifier, sizeof(INICacheIdentifier));
+	appendToBuffer(buffer, &INICacheVersion, sizeof(INICacheVersion));
+	appendToBuffer(buffer, &numEntries, sizeof(numEntries));
+
+	for (EntryMap::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		const Source &source = it->second.source;
+		const UnsignedInt linesSize = (UnsignedInt)it->second.lines.size();
+		appendString(buffer, it->first);
+		appendString(buffer, source.archiveFilename);
+		appendToBuffer(buffer, &source.archiveOffset, sizeof(source.archiveOffset));
+		appendToBuffer(buffer, &source.size, sizeof(source.size));
+		appendToBuffer(buffer, &source.timestampHigh, sizeof(source.timestampHigh));
+		appendToBuffer(buffer, &source.timestampLow, sizeof(source.timestampLow));
+		appendToBuffer(buffer, &linesSize, sizeof(linesSize));
+		if (linesSize > 0)
+			appendToBuffer(buffer, &it->second.lines[0], linesSize);
+	}
+
+	const UnsignedInt fileCRC = computeCRC(&buffer[0], (Int)buffer.size());
+	appendToBuffer(buffer, &fileCRC, sizeof(fileCRC));
+
+	File *file = TheFileSystem->openFile(m_filename.str(), File::WRITE | File::CREATE | File::BINARY);
+	if (file == NULL)
+	{
+		DEBUG_LOG(("INICache::save - cannot write %s", m_filename.str()));
+		return FALSE;
+	}
+
+	const Bool written = file->write(&buffer[0], (Int)buffer.size()) == (Int)buffer.size();
+	file->close();
+
+	m_dirty = !written;
+	return written;
+}
+
+//-------------------------------------------------------------------------------------------------
+const INICache::Entry *INICache::find(const AsciiString &sourceFilename, const Source &source) const
+{
+	AsciiString key = sourceFilename;
+	key.toLower();
+
+	EntryMap::const_iterator it = m_entries.find(key);
+	if (it == m_entries.end() || !(it->second.source == source))
+	{
+		++m_misses;
+		return NULL;
+	}
+
+	++m_hits;
+	return &it->second;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::store(const AsciiString &sourceFilename, const Source &source, const std::vector<char> &lines)
+{
+	AsciiString key = sourceFilename;
+	key.toLower();
+
+	Entry &entry = m_entries[key];
+	entry.source = source;
+	entry.lines = lines;
+	m_dirty = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Fills in where the given file comes from, looking in the same order as TheFileSystem opens it.
+	* An archived file carries the time stamp of its archive file, so the archive file name and the
+	* offset of the file in it tell apart a file that moved to another archive or within one. */
+//-------------------------------------------------------------------------------------------------
+Bool INICache::getSource(const AsciiString &sourceFilename, Source *source)
+{
+	FileInfo fileInfo;
+	memset(&fileInfo, 0, sizeof(fileInfo));
+	*source = Source();
+
+	if (TheLocalFileSystem->getFileInfo(sourceFilename, &fileInfo))
+	{
+		source->size = (UnsignedInt)fileInfo.sizeLow;
+	}
+	else if (!TheArchiveFileSystem->getArchivedFileLocation(sourceFilename, &source->archiveFilename, &source->archiveOffset, &source->size)
+		|| !TheLocalFileSystem->getFileInfo(source->archiveFilename, &fileInfo))
+	{
+		return FALSE;
+	}
+
+	source->timestampHigh = fileInfo.timestampHigh;
+	source->timestampLow = fileInfo.timestampLow;
+	return TRUE;
+}
@@ -0,0 +1,355 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/INIPrefetcher.h"
+#include "Common/ArchiveFileSystem.h"
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/LocalFileSystem.h"
+#include "Common/StartupTimeline.h"
+
+#include "mutex.h"
+#include "thread.h"
+
+INIPrefetcher *TheINIPrefetcher = NULL;
+
+static const Int MaxPrefetchThreads = 4;
+
+//-------------------------------------------------------------------------------------------------
+static Int64 getPrefetchTicks()
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+class INIPrefetchThread : public ThreadClass
+{
+public:
+	INIPrefetchThread(INIPrefetcher *prefetcher) : ThreadClass("INIPrefetchThread"), m_prefetcher(prefetcher) {}
+
+protected:
+	virtual void Thread_Function()
+	{
+		while (running)
+		{
+			if (!m_prefetcher->runNextJob())
+			{
+				if (m_prefetcher->isQueueFinished())
+					break;
+				Sleep_Ms(1);
+			}
+		}
+
+		releaseMemoryPoolThreadCache();
+	}
+
+private:
+	INIPrefetcher *m_prefetcher;
+};
+
+//-------------------------------------------------------------------------------------------------
+INIPrefetcher::INIPrefetcher(TokenizeProc tokenizeProc) :
+	m_tokenizeProc(tokenizeProc),
+	m_lock(NEW CriticalSectionClass),
+	m_nextJob(0),
+	m_queueFinished(FALSE),
+	m_ticksPerSecond(1),
+	m_queueTicks(0),
+	m_waitTicks(0),
+	m_readTicks(0),
+	m_tokenizeTicks(0),
+	m_bytesRead(0),
+	m_filesTaken(0),
+	m_filesTokenizedByMainThread(0)
+{
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		m_ticksPerSecond = freq.QuadPart;
+
+	// One core stays with the main thread, which parses the files.
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	const Int threadCount = clamp(1, (Int)systemInfo.dwNumberOfProcessors - 1, MaxPrefetchThreads);
+
+	for (Int i = 0; i < threadCount; ++i)
+	{
+		INIPrefetchThread *thread = NEW INIPrefetchThread(this);
+		m_threads.push_back(thread);
+		thread->Execute();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+INIPrefetcher::~INIPrefetcher()
+{
+	finishQueue();
+
+	for (size_t i = 0; i < m_threads.size(); ++i)
+		delete m_threads[i];
+	m_threads.clear();
+
+	for (size_t i = 0; i < m_jobs.size(); ++i)
+		delete m_jobs[i];
+	m_jobs.clear();
+	m_jobsByName.clear();
+
+	delete m_lock;
+}
+
+//-------------------------------------------------------------------------------------------------
+AsciiString INIPrefetcher::makeKey(const AsciiString &filename)
+{
+	AsciiString key;
+	for (const char *c = filename.str(); *c; ++c)
+		key.concat(*c == '/' ? '\\' : (char)tolower(*c));
+	return key;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INIPrefetcher::addDirectory(const AsciiString &path)
+{
+	AsciiString dirName = path;
+	if (!dirName.endsWith("\\"))
+		dirName.concat('\\');
+
+	FilenameList filenameList;
+	TheFileSystem->getFileListInDirectory(dirName, "*.ini", filenameList, TRUE);
+
+	for (FilenameList::const_iterator it = filenameList.begin(); it != filenameList.end(); ++it)
+		addFile(*it);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Looks up where the file is, in the same order as TheFileSystem opens it, and queues it.
+	* A local file is opened in the same text mode as INI::load opens it. An archived file is read
+	* from its archive file directly, like the archive file system does. */
+//-------------------------------------------------------------------------------------------------
+void INIPrefetcher::addFile(const AsciiString &filename)
+{
+	const AsciiString key = makeKey(filename);
+	if (m_jobsByName.find(key) != m_jobsByName.end())
+		return;
+
+	const Int64 startTicks = getPrefetchTicks();
+
+	Job *job = NEW Job;
+	job->filename = filename;
+	job->offset = 0;
+	job->size = -1;
+	job->state = JOB_QUEUED;
+	job->failed = FALSE;
+
+	if (TheLocalFileSystem->doesFileExist(filename.str()))
+	{
+		job->diskFilename = filename;
+		job->access = File::READ;
+	}
+	else
+	{
+		UnsignedInt size = 0;
+		if (!TheArchiveFileSystem->getArchivedFileLocation(filename, &job->diskFilename, &job->offset, &size))
+		{
+			delete job;
+			return;
+		}
+		job->access = File::READ | File::BINARY;
+		job->size = (Int)size;
+	}
+
+	m_jobsByName[key] = job;
+	m_queueTicks += getPrefetchTicks() - startTicks;
+
+	CriticalSectionClass::LockClass lock(*m_lock);
+	m_jobs.push_back(job);
+}
+
+//-------------------------------------------------------------------------------------------------
+void INIPrefetcher::finishQueue()
+{
+	CriticalSectionClass::LockClass lock(*m_lock);
+	m_queueFinished = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INIPrefetcher::isQueueFinished() const
+{
+	CriticalSectionClass::LockClass lock(*m_lock);
+	return m_queueFinished;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INIPrefetcher::runNextJob()
+{
+	Job *job = NULL;
+	{
+		CriticalSectionClass::LockClass lock(*m_lock);
+		while (m_nextJob < m_jobs.size() && job == NULL)
+		{
+			// The main thread may have split a file itself, when it needed it before a worker got to it.
+			Job *candidate = m_jobs[m_nextJob++];
+			if (candidate->state == JOB_QUEUED)
+			{
+				candidate->state = JOB_RUNNING;
+				job = candidate;
+			}
+		}
+	}
+
+	if (job == NULL)
+		return FALSE;
+
+	runJob(job);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Reads the text of the job on a worker thread. Apart from the count of open files in LocalFile,
+	* which is only used for logging, the local file system keeps no state while it opens a file for
+	* reading, so each worker can open its own file through it. */
+//-------------------------------------------------------------------------------------------------
+Bool INIPrefetcher::readText(const Job *job, std::vector<char> &text)
+{
+	File *file = TheLocalFileSystem->openFile(job->diskFilename.str(), job->access);
+	if (file == NULL)
+		return FALSE;
+
+	Bool success = TRUE;
+	if (job->size < 0)
+	{
+		// Like RAMFile::open, because a file in text mode can be shorter than its size on disk.
+		text.resize(file->size());
+		const Int bytesRead = text.empty() ? 0 : file->read(&text[0], (Int)text.size());
+		success = bytesRead >= 0;
+		if (success)
+			text.resize(bytesRead);
+	}
+	else
+	{
+		text.resize(job->size);
+		success = file->seek((Int)job->offset, File::START) == (Int)job->offset
+			&& (text.empty() || file->read(&text[0], job->size) == job->size);
+	}
+
+	file->close();
+	return success;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INIPrefetcher::runJob(Job *job)
+{
+	const Int64 startTicks = getPrefetchTicks();
+
+	std::vector<char> text;
+	const Bool readAll = readText(job, text);
+
+	const Int64 readTicks = getPrefetchTicks();
+
+	std::vector<char> lines;
+	if (readAll)
+		m_tokenizeProc(job->filename.str(), text.empty() ? "" : &text[0], (Int)text.size(), lines);
+
+	const Int64 tokenizeTicks = getPrefetchTicks() - readTicks;
+
+	CriticalSectionClass::LockClass lock(*m_lock);
+	job->lines.swap(lines);
+	job->failed = !readAll;
+	job->state = JOB_DONE;
+	m_readTicks += readTicks - startTicks;
+	m_tokenizeTicks += tokenizeTicks;
+	m_bytesRead += (UnsignedInt)text.size();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INIPrefetcher::takeLines(const AsciiString &filename, std::vector<char> &lines)
+{
+	JobMap::iterator it = m_jobsByName.find(makeKey(filename));
+	if (it == m_jobsByName.end())
+		return FALSE;
+
+	Job *job = it->second;
+	m_jobsByName.erase(it);
+
+	Bool runHere = FALSE;
+	{
+		CriticalSectionClass::LockClass lock(*m_lock);
+		if (job->state == JOB_QUEUED)
+		{
+			job->state = JOB_RUNNING;
+			runHere = TRUE;
+		}
+	}
+
+	if (runHere)
+	{
+		// Reading the file here is faster than waiting until a worker thread gets to it.
+		runJob(job);
+		++m_filesTokenizedByMainThread;
+	}
+	else
+	{
+		const Int64 startTicks = getPrefetchTicks();
+		for (;;)
+		{
+			{
+				CriticalSectionClass::LockClass lock(*m_lock);
+				if (job->state == JOB_DONE)
+					break;
+			}
+			ThreadClass::Switch_Thread();
+		}
+		m_waitTicks += getPrefetchTicks() - startTicks;
+	}
+
+	// The job is done, so no worker thread touches it anymore.
+	if (job->failed)
+		return FALSE;
+
+	lines.swap(job->lines);
+	std::vector<char> noLines;
+	job->lines.swap(noLines);
+	++m_filesTaken;
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INIPrefetcher::addCounters(StartupTimeline *timeline) const
+{
+	Int64 readTicks;
+	Int64 tokenizeTicks;
+	UnsignedInt bytesRead;
+	{
+		CriticalSectionClass::LockClass lock(*m_lock);
+		readTicks = m_readTicks;
+		tokenizeTicks = m_tokenizeTicks;
+		bytesRead = m_bytesRead;
+	}
+
+	timeline->addCounter("INI prefetch threads", (double)m_threads.size());
+	timeline->addCounter("INI prefetch files", (double)m_jobs.size());
+	timeline->addCounter("INI prefetch files used", (double)m_filesTaken);
+	timeline->addCounter("INI prefetch files split here", (double)m_filesTokenizedByMainThread);
+	timeline->addCounter("INI prefetch kilobytes", (double)bytesRead / 1024.0);
+	timeline->addCounter("INI prefetch queue seconds", (double)m_queueTicks / (double)m_ticksPerSecond);
+	timeline->addCounter("INI prefetch read seconds", (double)readTicks / (double)m_ticksPerSecond);
+	timeline->addCounter("INI prefetch split seconds", (double)tokenizeTicks / (double)m_ticksPerSecond);
+	timeline->addCounter("INI prefetch wait seconds", (double)m_waitTicks / (double)m_ticksPerSecond);
+}
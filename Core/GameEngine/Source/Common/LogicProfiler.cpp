@@ -0,0 +1,330 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/LogicProfiler.h"
+#include "Common/NameKeyGenerator.h"
+
+LogicProfiler *TheLogicProfiler = NULL;
+
+//-------------------------------------------------------------------------------------------------
+LogicProfiler::LogicProfiler() :
+	m_file(NULL),
+	m_format(OUTPUT_CSV),
+	m_ticksPerSecond(1),
+	m_openTicks(0),
+	m_frameStartTicks(0),
+	m_frame(0),
+	m_replayIndex(0),
+	m_inFrame(FALSE),
+	m_firstTraceEvent(TRUE)
+{
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		m_ticksPerSecond = freq.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+LogicProfiler::~LogicProfiler()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool LogicProfiler::open(const AsciiString &filename)
+{
+	close();
+
+	m_file = fopen(filename.str(), "w");
+	if (m_file == NULL)
+		return FALSE;
+
+	const char *ext = strrchr(filename.str(), '.');
+	m_format = (ext != NULL && stricmp(ext, ".json") == 0) ? OUTPUT_CHROME_TRACE : OUTPUT_CSV;
+	m_openTicks = getTicks();
+	m_replayIndex = 0;
+	m_firstTraceEvent = TRUE;
+
+	if (m_format == OUTPUT_CSV)
+		fprintf(m_file, "replay,frame,scope,calls,totalUs,selfUs\n");
+	else
+		fprintf(m_file, "{\"traceEvents\":[\n");
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::close()
+{
+	if (m_file == NULL)
+		return;
+
+	if (m_inFrame)
+		endFrame();
+
+	if (m_format == OUTPUT_CHROME_TRACE)
+		fprintf(m_file, "\n]}\n");
+
+	fclose(m_file);
+	m_file = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::beginReplay(const AsciiString &name)
+{
+	++m_replayIndex;
+
+	if (m_file != NULL && m_format == OUTPUT_CHROME_TRACE)
+	{
+		// Each replay gets its own process row in the trace viewer.
+		writeChromeTraceEventSeparator();
+		fprintf(m_file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":", m_replayIndex);
+		writeJSONString(m_file, name.str());
+		fprintf(m_file, "}}");
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::beginFrame(UnsignedInt frame)
+{
+	if (m_inFrame)
+		endFrame();
+
+	m_frame = frame;
+	m_inFrame = TRUE;
+	m_activeScopes.clear();
+	m_frameStartTicks = getTicks();
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::endFrame()
+{
+	if (!m_inFrame)
+		return;
+
+	DEBUG_ASSERTCRASH(m_activeScopes.empty(), ("LogicProfiler scopes still open at the end of the frame"));
+
+	if (m_file != NULL)
+	{
+		if (m_format == OUTPUT_CSV)
+			writeFrameCSV();
+		else
+			writeFrameChromeTrace();
+	}
+
+	for (std::vector<Int>::const_iterator it = m_frameSlots.begin(); it != m_frameSlots.end(); ++it)
+	{
+		ScopeStats &stats = m_scopes[*it];
+		stats.frameCalls = 0;
+		stats.frameTotalTicks = 0;
+		stats.frameSelfTicks = 0;
+		stats.usedThisFrame = FALSE;
+	}
+	m_frameSlots.clear();
+	m_inFrame = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::beginScope(const char *name)
+{
+	pushScope(getSlot(name));
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::beginScope(NameKeyType moduleNameKey)
+{
+	pushScope(getSlot(moduleNameKey));
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::pushScope(Int slot)
+{
+	if (!m_scopes[slot].usedThisFrame)
+	{
+		m_scopes[slot].usedThisFrame = TRUE;
+		m_frameSlots.push_back(slot);
+	}
+
+	ActiveScope scope;
+	scope.slot = slot;
+	scope.childTicks = 0;
+	scope.startTicks = getTicks();
+	m_activeScopes.push_back(scope);
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::endScope()
+{
+	const Int64 endTicks = getTicks();
+
+	if (m_activeScopes.empty())
+	{
+		DEBUG_CRASH(("LogicProfiler::endScope without beginScope"));
+		return;
+	}
+
+	const ActiveScope &scope = m_activeScopes.back();
+	const Int64 elapsedTicks = endTicks - scope.startTicks;
+
+	ScopeStats &stats = m_scopes[scope.slot];
+	++stats.frameCalls;
+	stats.frameTotalTicks += elapsedTicks;
+	stats.frameSelfTicks += elapsedTicks - scope.childTicks;
+
+	m_activeScopes.pop_back();
+
+	// Nested scopes are subtracted from the self time of the enclosing scope.
+	if (!m_activeScopes.empty())
+		m_activeScopes.back().childTicks += elapsedTicks;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int LogicProfiler::getSlot(const char *name)
+{
+	StaticNameSlotMap::const_iterator it = m_staticNameSlots.find(name);
+	if (it != m_staticNameSlots.end())
+		return it->second;
+
+	// Identical string literals are not guaranteed to share an address, so match by text once.
+	Int slot = -1;
+	for (size_t i = 0; i < m_scopes.size(); ++i)
+	{
+		if (m_scopes[i].name.compare(name) == 0)
+		{
+			slot = (Int)i;
+			break;
+		}
+	}
+	if (slot < 0)
+		slot = addSlot(name);
+
+	m_staticNameSlots[name] = slot;
+	return slot;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int LogicProfiler::getSlot(NameKeyType moduleNameKey)
+{
+	NameKeySlotMap::const_iterator it = m_nameKeySlots.find(moduleNameKey);
+	if (it != m_nameKeySlots.end())
+		return it->second;
+
+	const Int slot = addSlot(TheNameKeyGenerator->keyToName(moduleNameKey));
+	m_nameKeySlots[moduleNameKey] = slot;
+	return slot;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int LogicProfiler::addSlot(const AsciiString &name)
+{
+	ScopeStats stats;
+	stats.name = name;
+	stats.frameCalls = 0;
+	stats.frameTotalTicks = 0;
+	stats.frameSelfTicks = 0;
+	stats.usedThisFrame = FALSE;
+	m_scopes.push_back(stats);
+	return (Int)m_scopes.size() - 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::writeFrameCSV()
+{
+	const Int64 frameTicks = getTicks() - m_frameStartTicks;
+	fprintf(m_file, "%u,%u,Frame,1,%.1f,%.1f\n", m_replayIndex, m_frame,
+		ticksToMicroseconds(frameTicks), ticksToMicroseconds(frameTicks));
+
+	for (std::vector<Int>::const_iterator it = m_frameSlots.begin(); it != m_frameSlots.end(); ++it)
+	{
+		const ScopeStats &stats = m_scopes[*it];
+		fprintf(m_file, "%u,%u,%s,%u,%.1f,%.1f\n", m_replayIndex, m_frame, stats.name.str(), stats.frameCalls,
+			ticksToMicroseconds(stats.frameTotalTicks), ticksToMicroseconds(stats.frameSelfTicks));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::writeFrameChromeTrace()
+{
+	const Int64 nowTicks = getTicks();
+	const double startMicros = ticksToMicroseconds(m_frameStartTicks - m_openTicks);
+	const UnsignedInt pid = max(m_replayIndex, 1u);
+
+	writeChromeTraceEventSeparator();
+	fprintf(m_file, "{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":%u,\"tid\":0,\"ts\":%.1f,\"dur\":%.1f,\"args\":{\"frame\":%u}}",
+		pid, startMicros, ticksToMicroseconds(nowTicks - m_frameStartTicks), m_frame);
+
+	if (m_frameSlots.empty())
+		return;
+
+	// The self time of each scope is written as one counter, which the trace viewer stacks per frame.
+	writeChromeTraceEventSeparator();
+	fprintf(m_file, "{\"name\":\"Self time (us)\",\"ph\":\"C\",\"pid\":%u,\"ts\":%.1f,\"args\":{", pid, startMicros);
+	for (std::vector<Int>::const_iterator it = m_frameSlots.begin(); it != m_frameSlots.end(); ++it)
+	{
+		const ScopeStats &stats = m_scopes[*it];
+		if (it != m_frameSlots.begin())
+			fputc(',', m_file);
+		writeJSONString(m_file, stats.name.str());
+		fprintf(m_file, ":%.1f", ticksToMicroseconds(stats.frameSelfTicks));
+	}
+	fprintf(m_file, "}}");
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::writeChromeTraceEventSeparator()
+{
+	if (!m_firstTraceEvent)
+		fprintf(m_file, ",\n");
+	m_firstTraceEvent = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 LogicProfiler::getTicks() const
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+double LogicProfiler::ticksToMicroseconds(Int64 ticks) const
+{
+	return (double)ticks * 1000000.0 / (double)m_ticksPerSecond;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LogicProfiler::writeJSONString(FILE *file, const char *str)
+{
+	// Replay paths contain backslashes, which must be escaped like quotes and control characters.
+	// Bytes outside of ASCII are escaped as well, because the trace must be valid UTF-8.
+	fputc('"', file);
+	for (const unsigned char *c = (const unsigned char *)str; *c; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			fputc('\\', file);
+			fputc(*c, file);
+		}
+		else if (*c < 0x20 || *c >= 0x80)
+			fprintf(file, "\\u%04x", *c);
+		else
+			fputc(*c, file);
+	}
+	fputc('"', file);
+}
@@ -20,8 +20,10 @@
 
 #include "Common/ReplaySimulation.h"
 
+#include "Common/CRCDebug.h"
 #include "Common/GameEngine.h"
 #include "Common/LocalFileSystem.h"
+#include "Common/LogicProfiler.h"
 #include "Common/Recorder.h"
 #include "Common/WorkerProcess.h"
 #include "GameLogic/GameLogic.h"
@@ -45,9 +47,30 @@ int countProcessesRunning(const std::vector<WorkerProcess>& processes)
 	}
 	return numProcessesRunning;
 }
+
+// Maximum number of checkpoints kept in memory per replay.
+const UnsignedInt MAX_REPLAY_CHECKPOINTS = 16;
+
+// Each worker process writes its own profile, named after the first replay it simulates.
+AsciiString makeWorkerProfileFilename(const AsciiString &filename, int firstReplay)
+{
+	AsciiString base = filename;
+	AsciiString ext;
+	const char *dot = strrchr(filename.str(), '.');
+	const char *slash = max(strrchr(filename.str(), '/'), strrchr(filename.str(), '\\'));
+	if (dot != NULL && dot > slash)
+	{
+		ext = dot;
+		base.truncateBy(ext.getLength());
+	}
+
+	AsciiString result;
+	result.format("%s_%d%s", base.str(), firstReplay, ext.str());
+	return result;
+}
 } // namespace
 
-int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames)
+int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames, ReplayResults &results)
 {
 	int numErrors = 0;
 
@@ -60,8 +83,16 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		// If we are not in headless mode, we need to run the replay in the engine.
 		for (; s_replayIndex < s_replayCount; ++s_replayIndex)
 		{
+			ReplayResult result;
+			result.filename = filenames[s_replayIndex];
+			DWORD startTimeMillis = GetTickCount();
 			TheRecorder->playbackFile(filenames[s_replayIndex]);
 			TheGameEngine->execute();
+			result.logicFrames = TheGameLogic->getFrame();
+			result.wallTimeMillis = GetTickCount() - startTimeMillis;
+			result.success = !TheRecorder->sawCRCMismatch();
+			printReplayResult(result);
+			results.push_back(result);
 			if (TheRecorder->sawCRCMismatch())
 				numErrors++;
 			if (!s_isRunning)
@@ -75,14 +106,30 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 	}
 	// Note that we use printf here because this is run from cmd.
 	DWORD totalStartTimeMillis = GetTickCount();
+	TheRecorder->setCheckpointInterval(TheGlobalData->m_simulateReplayCheckpointInterval, MAX_REPLAY_CHECKPOINTS);
+	if (!TheGlobalData->m_simulateReplayProfile.isEmpty())
+	{
+		TheLogicProfiler = new LogicProfiler;
+		if (!TheLogicProfiler->open(TheGlobalData->m_simulateReplayProfile))
+		{
+			printf("Cannot write profile file \"%s\"\n", TheGlobalData->m_simulateReplayProfile.str());
+			delete TheLogicProfiler;
+			TheLogicProfiler = NULL;
+		}
+	}
 	for (size_t i = 0; i < filenames.size(); i++)
 	{
 		AsciiString filename = filenames[i];
+		ReplayResult result;
+		result.filename = filename;
 		printf("Simulating Replay \"%s\"\n", filename.str());
 		fflush(stdout);
+		if (TheLogicProfiler)
+			TheLogicProfiler->beginReplay(filename);
 		DWORD startTimeMillis = GetTickCount();
 		if (TheRecorder->simulateReplay(filename))
 		{
+			result.success = true;
 			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
 			while (TheRecorder->isPlaybackInProgress())
 			{
@@ -98,15 +145,21 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 							realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
 					fflush(stdout);
 				}
+				TheRecorder->updateCheckpoints();
 				TheGameLogic->UPDATE();
 				if (TheRecorder->sawCRCMismatch())
 				{
+					result.success = false;
 					numErrors++;
+					if (TheGlobalData->m_simulateReplayCheckpointInterval != 0)
+						resimulateFromCheckpoint();
 					break;
 				}
 			}
+			result.logicFrames = TheGameLogic->getFrame();
+			result.wallTimeMillis = GetTickCount() - startTimeMillis;
 			UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
-			UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
+			UnsignedInt realTimeSec = result.wallTimeMillis / 1000;
 			printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
 					realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
 			fflush(stdout);
@@ -116,6 +169,14 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 			printf("Cannot open replay\n");
 			numErrors++;
 		}
+		printReplayResult(result);
+		results.push_back(result);
+	}
+	if (TheLogicProfiler)
+	{
+		delete TheLogicProfiler;
+		TheLogicProfiler = NULL;
+		printf("Profile written to \"%s\"\n", TheGlobalData->m_simulateReplayProfile.str());
 	}
 	if (filenames.size() > 1)
 	{
@@ -129,7 +190,7 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 	return numErrors != 0 ? 1 : 0;
 }
 
-int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses)
+int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess, ReplayResults &results)
 {
 	DWORD totalStartTimeMillis = GetTickCount();
 
@@ -137,6 +198,7 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	GetModuleFileNameW(NULL, exePath, ARRAY_SIZE(exePath));
 
 	std::vector<WorkerProcess> processes;
+	std::vector<size_t> processReplayCounts;
 	int filenamePositionStarted = 0;
 	int filenamePositionDone = 0;
 	int numErrors = 0;
@@ -152,15 +214,32 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		{
 			if (!processes[0].isDone())
 				break;
+			const size_t replayCount = processReplayCounts[0];
 			AsciiString stdOutput = processes[0].getStdOutput();
-			printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
+			if (replayCount == 1)
+				printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
+			else
+				printf("%d-%d/%d\n%s", filenamePositionDone+1, filenamePositionDone+(int)replayCount, (int)filenames.size(), stdOutput.str());
 			DWORD exitcode = processes[0].getExitCode();
 			if (exitcode != 0)
 				printf("Error!\n");
 			fflush(stdout);
-			numErrors += exitcode == 0 ? 0 : 1;
+
+			const size_t firstResult = results.size();
+			int batchErrors = 0;
+			parseReplayResults(stdOutput, results, replayCount, exitcode == 0);
+			for (size_t r = firstResult; r < results.size(); ++r)
+			{
+				results[r].filename = filenames[filenamePositionDone + (r - firstResult)];
+				batchErrors += results[r].success ? 0 : 1;
+			}
+			if (exitcode != 0 && batchErrors == 0)
+				batchErrors = 1;
+			numErrors += batchErrors;
+
 			processes.erase(processes.begin());
-			filenamePositionDone++;
+			processReplayCounts.erase(processReplayCounts.begin());
+			filenamePositionDone += (int)replayCount;
 		}
 
 		int numProcessesRunning = countProcessesRunning(processes);
@@ -168,19 +247,52 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		// Add new processes when we are below the limit and there are replays left
 		while (numProcessesRunning < maxProcesses && filenamePositionStarted < filenames.size())
 		{
-			UnicodeString filenameWide;
-			filenameWide.translate(filenames[filenamePositionStarted]);
+			const int replayCount = min(replaysPerProcess, (int)filenames.size() - filenamePositionStarted);
 			UnicodeString command;
-			command.format(L"\"%s\"%s%s -replay \"%s\"",
+			command.format(L"\"%s\"%s%s",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
-				TheGlobalData->m_headless ? L" -headless" : L"",
-				filenameWide.str());
+				TheGlobalData->m_headless ? L" -headless" : L"");
+
+			if (TheGlobalData->m_simulateReplayCheckpointInterval != 0)
+			{
+				UnicodeString checkpointArg;
+				checkpointArg.format(L" -replayCheckpoints %u", TheGlobalData->m_simulateReplayCheckpointInterval);
+				command.concat(checkpointArg);
+			}
+
+			if (!TheGlobalData->m_simulateReplayProfile.isEmpty())
+			{
+				UnicodeString profileFilenameWide;
+				profileFilenameWide.translate(makeWorkerProfileFilename(TheGlobalData->m_simulateReplayProfile, filenamePositionStarted + 1));
+				UnicodeString profileArg;
+				profileArg.format(L" -replayProfile \"%s\"", profileFilenameWide.str());
+				command.concat(profileArg);
+			}
+
+			if (!TheGlobalData->m_scriptProfileFile.isEmpty())
+			{
+				UnicodeString profileFilenameWide;
+				profileFilenameWide.translate(makeWorkerProfileFilename(TheGlobalData->m_scriptProfileFile, filenamePositionStarted + 1));
+				UnicodeString profileArg;
+				profileArg.format(L" -scriptProfile \"%s\"", profileFilenameWide.str());
+				command.concat(profileArg);
+			}
+
+			for (int r = 0; r < replayCount; ++r)
+			{
+				UnicodeString filenameWide;
+				filenameWide.translate(filenames[filenamePositionStarted + r]);
+				UnicodeString replayArg;
+				replayArg.format(L" -replay \"%s\"", filenameWide.str());
+				command.concat(replayArg);
+			}
 
 			processes.push_back(WorkerProcess());
 			processes.back().startProcess(command);
+			processReplayCounts.push_back(replayCount);
 
-			filenamePositionStarted++;
+			filenamePositionStarted += replayCount;
 			numProcessesRunning++;
 		}
 
@@ -203,6 +315,123 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	return numErrors != 0 ? 1 : 0;
 }
 
+void ReplaySimulation::resimulateFromCheckpoint()
+{
+	// Start before the last matching CRC, because the state may already have diverged after it.
+	const UnsignedInt mismatchFrame = TheRecorder->getCRCMismatchFrame();
+	const UnsignedInt endFrame = TheGameLogic->getFrame();
+	const UnsignedInt searchFrame = mismatchFrame > (UnsignedInt)REPLAY_CRC_INTERVAL ? mismatchFrame - REPLAY_CRC_INTERVAL : 0;
+	const UnsignedInt checkpointFrame = TheRecorder->getCheckpointFrame(searchFrame);
+
+	DWORD startTimeMillis = GetTickCount();
+	if (!TheRecorder->restoreCheckpoint(searchFrame))
+	{
+		printf("No checkpoint available before frame %u\n", mismatchFrame);
+		fflush(stdout);
+		return;
+	}
+
+	printf("Resimulating from checkpoint at frame %u\n", checkpointFrame);
+	fflush(stdout);
+
+	while (TheRecorder->isPlaybackInProgress() && !TheRecorder->sawCRCMismatch() && TheGameLogic->getFrame() <= endFrame)
+	{
+		TheGameClient->updateHeadless();
+		TheGameLogic->UPDATE();
+	}
+
+	if (TheRecorder->sawCRCMismatch())
+		printf("CRC mismatch in frame %u reproduced from checkpoint in %u ms\n", TheRecorder->getCRCMismatchFrame(), GetTickCount() - startTimeMillis);
+	else
+		printf("CRC mismatch did not reproduce from checkpoint\n");
+	fflush(stdout);
+}
+
+void ReplaySimulation::printReplayResult(const ReplayResult &result)
+{
+	// This line is parsed by the parent process in parseReplayResults.
+	printf("Replay Result: %u %u %d\n", result.logicFrames, result.wallTimeMillis, result.success ? 1 : 0);
+	fflush(stdout);
+}
+
+void ReplaySimulation::parseReplayResults(const AsciiString &stdOutput, ReplayResults &results, size_t count, Bool exitedWithSuccess)
+{
+	static const char ResultTag[] = "Replay Result: ";
+
+	size_t numParsed = 0;
+	const char *line = stdOutput.str();
+	while (line != NULL && numParsed < count)
+	{
+		line = strstr(line, ResultTag);
+		if (line == NULL)
+			break;
+		line += sizeof(ResultTag) - 1;
+
+		ReplayResult result;
+		int success = 0;
+		if (sscanf(line, "%u %u %d", &result.logicFrames, &result.wallTimeMillis, &success) == 3)
+		{
+			result.success = success != 0;
+			results.push_back(result);
+			++numParsed;
+		}
+	}
+
+	// Replays without a result line were not simulated to the end. If the worker printed no result
+	// line at all, it may be an older build, so its exit code decides the result of the whole batch.
+	const Bool fallbackSuccess = numParsed == 0 && exitedWithSuccess;
+	for (; numParsed < count; ++numParsed)
+	{
+		ReplayResult result;
+		result.success = fallbackSuccess;
+		results.push_back(result);
+	}
+}
+
+void ReplaySimulation::writeSummary(const AsciiString &summaryFilename, const ReplayResults &results, UnsignedInt totalWallTimeMillis, int maxProcesses)
+{
+	FILE *fp = fopen(summaryFilename.str(), "w");
+	if (fp == NULL)
+	{
+		printf("Cannot write summary file \"%s\"\n", summaryFilename.str());
+		return;
+	}
+
+	UnsignedInt numErrors = 0;
+	UnsignedInt totalLogicFrames = 0;
+	UnsignedInt totalReplayMillis = 0;
+	for (ReplayResults::const_iterator it = results.begin(); it != results.end(); ++it)
+	{
+		numErrors += it->success ? 0 : 1;
+		totalLogicFrames += it->logicFrames;
+		totalReplayMillis += it->wallTimeMillis;
+	}
+
+	const double wallSeconds = max(totalWallTimeMillis, 1u) / 1000.0;
+	const double replaySeconds = max(totalReplayMillis, 1u) / 1000.0;
+
+	fprintf(fp, "replays=%u\n", (UnsignedInt)results.size());
+	fprintf(fp, "errors=%u\n", numErrors);
+	fprintf(fp, "jobs=%d\n", maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL ? 1 : maxProcesses);
+	fprintf(fp, "wallTimeMs=%u\n", totalWallTimeMillis);
+	fprintf(fp, "logicFrames=%u\n", totalLogicFrames);
+	fprintf(fp, "replaysPerSecond=%.3f\n", results.size() / wallSeconds);
+	fprintf(fp, "logicFramesPerSecond=%.1f\n", totalLogicFrames / wallSeconds);
+	fprintf(fp, "logicFramesPerSecondPerJob=%.1f\n", totalLogicFrames / replaySeconds);
+	fprintf(fp, "\n");
+	fprintf(fp, "result,logicFrames,wallTimeMs,logicFramesPerSecond,replay\n");
+	for (ReplayResults::const_iterator it = results.begin(); it != results.end(); ++it)
+	{
+		const double seconds = max(it->wallTimeMillis, 1u) / 1000.0;
+		fprintf(fp, "%s,%u,%u,%.1f,\"%s\"\n",
+			it->success ? "OK" : "ERROR", it->logicFrames, it->wallTimeMillis, it->logicFrames / seconds, it->filename.str());
+	}
+
+	fclose(fp);
+	printf("Summary written to \"%s\"\n", summaryFilename.str());
+	fflush(stdout);
+}
+
 std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::vector<AsciiString> &filenames)
 {
 	// If some filename contains wildcards, search for actual filenames.
@@ -245,11 +474,21 @@ std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::v
 	return filenamesResolved;
 }
 
-int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses)
+int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess, const AsciiString &summaryFilename)
 {
+	DWORD totalStartTimeMillis = GetTickCount();
 	std::vector<AsciiString> filenamesResolved = resolveFilenameWildcards(filenames);
+	ReplayResults results;
+	results.reserve(filenamesResolved.size());
+
+	int exitcode;
 	if (maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL)
-		return simulateReplaysInThisProcess(filenamesResolved);
+		exitcode = simulateReplaysInThisProcess(filenamesResolved, results);
 	else
-		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses);
+		exitcode = simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses, max(replaysPerProcess, 1), results);
+
+	if (!summaryFilename.isEmpty())
+		writeSummary(summaryFilename, results, GetTickCount() - totalStartTimeMillis, maxProcesses);
+
+	return exitcode;
 }
@@ -0,0 +1,197 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ScriptProfiler.h"
+
+ScriptProfiler *TheScriptProfiler = NULL;
+
+static const Int MaxLoggedScripts = 20;
+
+//-------------------------------------------------------------------------------------------------
+struct ScriptProfiler::SlowerScript
+{
+	SlowerScript(const ScriptProfiler &profiler) : m_profiler(profiler) {}
+
+	bool operator()(Int a, Int b) const
+	{
+		return m_profiler.getTotalTicks(m_profiler.m_scripts[a]) > m_profiler.getTotalTicks(m_profiler.m_scripts[b]);
+	}
+
+	const ScriptProfiler &m_profiler;
+};
+
+//-------------------------------------------------------------------------------------------------
+ScriptProfiler::ScriptProfiler() :
+	m_file(NULL),
+	m_ticksPerSecond(1),
+	m_gameIndex(0)
+{
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		m_ticksPerSecond = freq.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+ScriptProfiler::~ScriptProfiler()
+{
+	endGame();
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool ScriptProfiler::open(const AsciiString &filename)
+{
+	close();
+
+	m_file = fopen(filename.str(), "w");
+	if (m_file == NULL)
+		return FALSE;
+
+	fprintf(m_file, "game,map,kind,script,totalMs,evaluations,conditionMs,actionRuns,actionMs,groupRuns,groupMs\n");
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::close()
+{
+	if (m_file == NULL)
+		return;
+
+	fclose(m_file);
+	m_file = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::beginGame(const AsciiString &mapName)
+{
+	endGame();
+
+	++m_gameIndex;
+	m_mapName = mapName;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::endGame()
+{
+	if (m_scripts.empty())
+		return;
+
+	// The scripts are listed from the slowest to the fastest.
+	std::vector<Int> order;
+	order.reserve(m_scripts.size());
+	for (size_t i = 0; i < m_scripts.size(); ++i)
+		order.push_back((Int)i);
+	std::sort(order.begin(), order.end(), SlowerScript(*this));
+
+	DEBUG_LOG(("Script profile of game %u on %s: %d scripts", m_gameIndex, m_mapName.str(), (Int)m_scripts.size()));
+	DEBUG_LOG(("  %-10s %-40s %10s %10s %10s %10s %10s", "kind", "script", "total ms", "evals", "cond ms", "actions", "action ms"));
+	for (size_t i = 0; i < order.size() && (Int)i < MaxLoggedScripts; ++i)
+	{
+		const ScriptStats &stats = m_scripts[order[i]];
+		DEBUG_LOG(("  %-10s %-40s %10.3f %10u %10.3f %10u %10.3f", stats.kind, stats.name.str(),
+			ticksToMilliseconds(getTotalTicks(stats)), stats.count[PHASE_CONDITIONS], ticksToMilliseconds(stats.ticks[PHASE_CONDITIONS]),
+			stats.count[PHASE_ACTIONS], ticksToMilliseconds(stats.ticks[PHASE_ACTIONS])));
+	}
+
+	if (m_file != NULL)
+	{
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			const ScriptStats &stats = m_scripts[order[i]];
+			fprintf(m_file, "%u,", m_gameIndex);
+			writeCSVString(m_file, m_mapName);
+			fprintf(m_file, ",%s,", stats.kind);
+			writeCSVString(m_file, stats.name);
+			fprintf(m_file, ",%.6f,%u,%.6f,%u,%.6f,%u,%.6f\n",
+				ticksToMilliseconds(getTotalTicks(stats)),
+				stats.count[PHASE_CONDITIONS], ticksToMilliseconds(stats.ticks[PHASE_CONDITIONS]),
+				stats.count[PHASE_ACTIONS], ticksToMilliseconds(stats.ticks[PHASE_ACTIONS]),
+				stats.count[PHASE_GROUP], ticksToMilliseconds(stats.ticks[PHASE_GROUP]));
+		}
+		fflush(m_file);
+	}
+
+	m_scripts.clear();
+	m_slots.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+Int ScriptProfiler::getSlot(const void *script, const char *kind, const AsciiString &name)
+{
+	ScriptSlotMap::const_iterator it = m_slots.find(script);
+	if (it != m_slots.end())
+		return it->second;
+
+	ScriptStats stats;
+	stats.kind = kind;
+	stats.name = name;
+	for (Int phase = 0; phase < PHASE_COUNT; ++phase)
+	{
+		stats.count[phase] = 0;
+		stats.ticks[phase] = 0;
+	}
+	m_scripts.push_back(stats);
+
+	const Int slot = (Int)m_scripts.size() - 1;
+	m_slots[script] = slot;
+	return slot;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::addTime(Int slot, Phase phase, Int64 ticks)
+{
+	ScriptStats &stats = m_scripts[slot];
+	++stats.count[phase];
+	stats.ticks[phase] += ticks;
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 ScriptProfiler::getTotalTicks(const ScriptStats &stats) const
+{
+	// A group's time already contains the times of its scripts, so it stands on its own.
+	return stats.ticks[PHASE_CONDITIONS] + stats.ticks[PHASE_ACTIONS] + stats.ticks[PHASE_GROUP];
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 ScriptProfiler::getTicks() const
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+double ScriptProfiler::ticksToMilliseconds(Int64 ticks) const
+{
+	return (double)ticks * 1000.0 / (double)m_ticksPerSecond;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScriptProfiler::writeCSVString(FILE *file, const AsciiString &str)
+{
+	fputc('"', file);
+	for (const char *c = str.str(); *c; ++c)
+	{
+		if (*c == '"')
+			fputc('"', file);
+		fputc(*c, file);
+	}
+	fputc('"', file);
+}
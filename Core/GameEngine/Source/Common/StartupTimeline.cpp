@@ -0,0 +1,177 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/StartupTimeline.h"
+
+StartupTimeline *TheStartupTimeline = NULL;
+
+//-------------------------------------------------------------------------------------------------
+StartupTimeline::StartupTimeline() :
+	m_ticksPerSecond(1),
+	m_startTicks(0),
+	m_phaseStartTicks(0),
+	m_openSubsystem(-1)
+{
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		m_ticksPerSecond = freq.QuadPart;
+
+	m_startTicks = getTicks();
+	m_phaseStartTicks = m_startTicks;
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::mark(const char *phase)
+{
+	Phase entry;
+	entry.name = phase;
+	entry.startTicks = m_phaseStartTicks;
+	entry.endTicks = getTicks();
+	m_phases.push_back(entry);
+
+	m_phaseStartTicks = entry.endTicks;
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::beginSubsystem(const AsciiString &name)
+{
+	DEBUG_ASSERTCRASH(m_openSubsystem < 0, ("StartupTimeline: subsystem %s begins inside of another one", name.str()));
+
+	Subsystem entry;
+	entry.name = name;
+	entry.startTicks = getTicks();
+	entry.initEndTicks = entry.startTicks;
+	entry.endTicks = entry.startTicks;
+	m_subsystems.push_back(entry);
+
+	m_openSubsystem = (Int)m_subsystems.size() - 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::endSubsystemInit()
+{
+	if (m_openSubsystem >= 0)
+		m_subsystems[m_openSubsystem].initEndTicks = getTicks();
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::endSubsystem()
+{
+	if (m_openSubsystem >= 0)
+	{
+		m_subsystems[m_openSubsystem].endTicks = getTicks();
+		m_openSubsystem = -1;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::addCounter(const char *name, double value)
+{
+	Counter counter;
+	counter.name = name;
+	counter.value = value;
+	m_counters.push_back(counter);
+}
+
+//-------------------------------------------------------------------------------------------------
+void StartupTimeline::report(const AsciiString &filename) const
+{
+	const Int64 endTicks = m_phases.empty() ? getTicks() : m_phases.back().endTicks;
+	const double totalSeconds = ticksToSeconds(endTicks - m_startTicks);
+
+	DEBUG_LOG(("Startup timeline: %.3f seconds in %d phases and %d subsystems",
+		totalSeconds, (Int)m_phases.size(), (Int)m_subsystems.size()));
+
+	for (size_t i = 0; i < m_phases.size(); ++i)
+	{
+		const Phase &phase = m_phases[i];
+		const double seconds = ticksToSeconds(phase.endTicks - phase.startTicks);
+		DEBUG_LOG(("  %-32s %8.3f s  at %8.3f s  %5.1f%%", phase.name.str(), seconds,
+			ticksToSeconds(phase.endTicks - m_startTicks), totalSeconds > 0.0 ? seconds * 100.0 / totalSeconds : 0.0));
+	}
+
+	// The subsystems are listed from the slowest to the fastest.
+	std::vector<Int> order;
+	order.reserve(m_subsystems.size());
+	for (size_t i = 0; i < m_subsystems.size(); ++i)
+	{
+		const Int64 ticks = m_subsystems[i].endTicks - m_subsystems[i].startTicks;
+		std::vector<Int>::iterator it = order.begin();
+		while (it != order.end() && m_subsystems[*it].endTicks - m_subsystems[*it].startTicks >= ticks)
+			++it;
+		order.insert(it, (Int)i);
+	}
+
+	DEBUG_LOG(("  %-32s %8s    %8s    %8s", "Subsystem", "total", "init", "INI"));
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		const Subsystem &sys = m_subsystems[order[i]];
+		DEBUG_LOG(("  %-32s %8.3f s  %8.3f s  %8.3f s", sys.name.str(),
+			ticksToSeconds(sys.endTicks - sys.startTicks),
+			ticksToSeconds(sys.initEndTicks - sys.startTicks),
+			ticksToSeconds(sys.endTicks - sys.initEndTicks)));
+	}
+
+	for (size_t i = 0; i < m_counters.size(); ++i)
+		DEBUG_LOG(("  %-32s %12.3f", m_counters[i].name.str(), m_counters[i].value));
+
+	if (filename.isEmpty())
+		return;
+
+	FILE *file = fopen(filename.str(), "w");
+	if (file == NULL)
+	{
+		DEBUG_LOG(("StartupTimeline: cannot write %s", filename.str()));
+		return;
+	}
+
+	fprintf(file, "kind,name,startSeconds,seconds,initSeconds,iniSeconds\n");
+	for (size_t i = 0; i < m_phases.size(); ++i)
+	{
+		const Phase &phase = m_phases[i];
+		fprintf(file, "phase,%s,%.6f,%.6f,,\n", phase.name.str(),
+			ticksToSeconds(phase.startTicks - m_startTicks), ticksToSeconds(phase.endTicks - phase.startTicks));
+	}
+	for (size_t i = 0; i < m_subsystems.size(); ++i)
+	{
+		const Subsystem &sys = m_subsystems[i];
+		fprintf(file, "subsystem,%s,%.6f,%.6f,%.6f,%.6f\n", sys.name.str(),
+			ticksToSeconds(sys.startTicks - m_startTicks), ticksToSeconds(sys.endTicks - sys.startTicks),
+			ticksToSeconds(sys.initEndTicks - sys.startTicks), ticksToSeconds(sys.endTicks - sys.initEndTicks));
+	}
+	for (size_t i = 0; i < m_counters.size(); ++i)
+		fprintf(file, "counter,%s,,%.6f,,\n", m_counters[i].name.str(), m_counters[i].value);
+
+	fclose(file);
+}
+
+//-------------------------------------------------------------------------------------------------
+Int64 StartupTimeline::getTicks() const
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+double StartupTimeline::ticksToSeconds(Int64 ticks) const
+{
+	return (double)ticks / (double)m_ticksPerSecond;
+}
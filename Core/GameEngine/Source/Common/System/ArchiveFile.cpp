@@ -233,3 +233,16 @@ const ArchivedFileInfo * ArchiveFile::getArchivedFileInfo(const AsciiString& fil
 	}
 
 }
+
+Bool ArchiveFile::getArchivedFileLocation(const AsciiString& filename, UnsignedInt *offset, UnsignedInt *size) const
+{
+	const ArchivedFileInfo *fileInfo = getArchivedFileInfo(filename);
+	if (fileInfo == NULL)
+	{
+		return FALSE;
+	}
+
+	*offset = fileInfo->m_offset;
+	*size = fileInfo->m_size;
+	return TRUE;
+}
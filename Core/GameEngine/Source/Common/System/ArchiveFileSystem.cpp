@@ -98,10 +98,136 @@ ArchiveFileSystem *TheArchiveFileSystem = NULL;
 //         Public Functions                                                
 //----------------------------------------------------------------------------
 
+//------------------------------------------------------
+// ArchivedFileIndex
+//------------------------------------------------------
+ArchivedFileIndex::ArchivedFileIndex() : m_count(0)
+{
+}
+
+void ArchivedFileIndex::clear()
+{
+	m_entries.clear();
+	m_count = 0;
+}
+
+Int ArchivedFileIndex::makeKey(const char *path, char *key)
+{
+	// The directory tree takes the last part of the path that has a dot as the file name and
+	// ignores the parts after it, so the key ends there too. Separators are unified to '\\'.
+	Int length = 0;
+	Int keyLength = 0;
+	Bool inPart = FALSE;
+	Bool partHasDot = FALSE;
+
+	for (const char *c = path; ; ++c)
+	{
+		if (*c == '\\' || *c == '/' || *c == 0)
+		{
+			if (partHasDot)
+				keyLength = length;
+			inPart = FALSE;
+			partHasDot = FALSE;
+			if (*c == 0)
+				break;
+			continue;
+		}
+
+		if (length + 2 > MAX_KEY_LENGTH)
+			return -1;
+
+		if (!inPart)
+		{
+			if (length > 0)
+				key[length++] = '\\';
+			inPart = TRUE;
+		}
+
+		if (*c == '.')
+			partHasDot = TRUE;
+		key[length++] = tolower(*c);
+	}
+
+	key[keyLength] = 0;
+	return keyLength;
+}
+
+UnsignedInt ArchivedFileIndex::hashKey(const char *key, Int keyLength)
+{
+	// FNV-1a
+	UnsignedInt hash = 2166136261u;
+	for (Int i = 0; i < keyLength; ++i)
+	{
+		hash ^= (UnsignedByte)key[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+Int ArchivedFileIndex::findSlot(const char *key, Int keyLength, UnsignedInt hash) const
+{
+	const Int mask = (Int)m_entries.size() - 1;
+	Int slot = (Int)(hash & mask);
+
+	for (;;)
+	{
+		const Entry &entry = m_entries[slot];
+		if (entry.key.isEmpty())
+			return slot;
+		if (entry.hash == hash && entry.key.getLength() == keyLength && memcmp(entry.key.str(), key, keyLength) == 0)
+			return slot;
+		slot = (slot + 1) & mask;
+	}
+}
+
+void ArchivedFileIndex::grow()
+{
+	std::vector<Entry> oldEntries;
+	oldEntries.swap(m_entries);
+	m_entries.resize(oldEntries.empty() ? 1024 : oldEntries.size() * 2);
+
+	for (std::vector<Entry>::const_iterator it = oldEntries.begin(); it != oldEntries.end(); ++it)
+	{
+		if (it->key.isEmpty())
+			continue;
+		m_entries[findSlot(it->key.str(), it->key.getLength(), it->hash)] = *it;
+	}
+}
+
+void ArchivedFileIndex::insert(const char *key, Int keyLength, const AsciiString& archiveFilename, Bool overwrite)
+{
+	// keep the load factor below 3/4, so that the probe sequences stay short.
+	if ((m_count + 1) * 4 > (Int)m_entries.size() * 3)
+		grow();
+
+	const UnsignedInt hash = hashKey(key, keyLength);
+	Entry &entry = m_entries[findSlot(key, keyLength, hash)];
+	if (entry.key.isEmpty())
+	{
+		entry.hash = hash;
+		entry.key = key;
+		entry.archiveFilename = archiveFilename;
+		++m_count;
+	}
+	else if (overwrite)
+	{
+		entry.archiveFilename = archiveFilename;
+	}
+}
+
+const AsciiString* ArchivedFileIndex::find(const char *key, Int keyLength) const
+{
+	if (m_entries.empty())
+		return NULL;
+
+	const Entry &entry = m_entries[findSlot(key, keyLength, hashKey(key, keyLength))];
+	return entry.key.isEmpty() ? NULL : &entry.archiveFilename;
+}
+
 //------------------------------------------------------
 // ArchivedFileInfo
 //------------------------------------------------------
-ArchiveFileSystem::ArchiveFileSystem() 
+ArchiveFileSystem::ArchiveFileSystem() : m_lookupCount(0)
 {
 }
 
@@ -125,15 +251,58 @@ void ArchiveFileSystem::loadIntoDirectoryTree(const ArchiveFile *archiveFile, co
 
 	archiveFile->getFileListInDirectory(AsciiString(""), AsciiString(""), AsciiString("*"), filenameList, TRUE);
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The file list is sorted, so the files of one directory follow each other.
+	// The directory is looked up once for all of them, instead of walking the tree again for each file.
+	AsciiString lastDirectoryPath;
+	ArchivedDirectoryInfo *lastDirInfo = NULL;
+
 	FilenameListIter it = filenameList.begin();
 
 	while (it != filenameList.end()) {
+		// add this filename to the path index. It resolves to the same place as in the directory tree.
+		char key[ArchivedFileIndex::MAX_KEY_LENGTH];
+		const Int keyLength = ArchivedFileIndex::makeKey(it->str(), key);
+		if (keyLength > 0)
+			m_fileIndex.insert(key, keyLength, archiveFilename, overwrite);
+
 		// add this filename to the directory tree.
 		AsciiString path = *it;
 		path.toLower();
 		AsciiString token;
 		AsciiString debugpath;
 
+		// A directory name with a dot is taken as the file name when the rest of the path has no dot,
+		// so the fast path only handles file names with a dot, where all parts before it are directories.
+		const char *filename = path.reverseFind('\\');
+		filename = (filename != NULL) ? filename + 1 : path.str();
+		if (strchr(filename, '.') != NULL && strchr(filename, '/') == NULL) {
+			AsciiString directoryPath;
+			directoryPath.set(path);
+			directoryPath.truncateBy((Int)strlen(filename));
+
+			if (lastDirInfo == NULL || directoryPath != lastDirectoryPath) {
+				lastDirInfo = &m_rootDirectory;
+				AsciiString dirToken;
+				AsciiString dirPath = directoryPath;
+				while (dirPath.nextToken(&dirToken, "\\/")) {
+					ArchivedDirectoryInfo &childInfo = lastDirInfo->m_directories[dirToken];
+					if (childInfo.m_directoryName.isEmpty()) {
+						childInfo.m_directoryName = dirToken;
+					}
+					lastDirInfo = &childInfo;
+				}
+				lastDirectoryPath = directoryPath;
+			}
+
+			token = filename;
+			if (overwrite || lastDirInfo->m_files.find(token) == lastDirInfo->m_files.end()) {
+				lastDirInfo->m_files[token] = archiveFilename;
+			}
+
+			it++;
+			continue;
+		}
+
 		ArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
 
 		Bool infoInPath;
@@ -195,34 +364,7 @@ void ArchiveFileSystem::loadMods() {
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename) const
 {
-	AsciiString path = filename;
-	path.toLower();
-	AsciiString token;
-
-	const ArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
-
-	path.nextToken(&token, "\\/");
-
-	while (!token.find('.') || path.find('.')) 
-	{
-		ArchivedDirectoryInfoMap::const_iterator tempiter = dirInfo->m_directories.find(token);
-		if (tempiter != dirInfo->m_directories.end()) 
-		{
-			dirInfo = &tempiter->second;
-			path.nextToken(&token, "\\/");
-		}
-		else
-		{
-			// the directory doesn't exist, so return false
-			return FALSE;
-		}
-	}
-
-	// token is the filename, and dirInfo is the directory that this file is in.
-	if (dirInfo->m_files.find(token) == dirInfo->m_files.end()) {
-		return FALSE;
-	}
-	return TRUE;
+	return lookupArchiveFilename(filename).isNotEmpty();
 }
 
 File * ArchiveFileSystem::openFile(const Char *filename, Int access /* = 0 */) 
@@ -260,6 +402,38 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 }
 
 AsciiString ArchiveFileSystem::getArchiveFilenameForFile(const AsciiString& filename) const
+{
+	return lookupArchiveFilename(filename.str());
+}
+
+Bool ArchiveFileSystem::getArchivedFileLocation(const AsciiString& filename, AsciiString *archiveFilename, UnsignedInt *offset, UnsignedInt *size) const
+{
+	*archiveFilename = getArchiveFilenameForFile(filename);
+	ArchiveFileMap::const_iterator it = m_archiveFileMap.find(*archiveFilename);
+	if (it == m_archiveFileMap.end())
+	{
+		return FALSE;
+	}
+
+	return it->second->getArchivedFileLocation(filename, offset, size);
+}
+
+// TheSuperHackers @performance alanblack166 18/10/2026 Files are looked up by their full path in the hash index. Only paths
+// that are too long for the index fall back to walking the directory tree one directory at a time.
+const AsciiString& ArchiveFileSystem::lookupArchiveFilename(const Char *filename) const
+{
+	++m_lookupCount;
+
+	char key[ArchivedFileIndex::MAX_KEY_LENGTH];
+	const Int keyLength = ArchivedFileIndex::makeKey(filename, key);
+	if (keyLength < 0)
+		return getArchiveFilenameFromTree(AsciiString(filename));
+
+	const AsciiString *archiveFilename = (keyLength > 0) ? m_fileIndex.find(key, keyLength) : NULL;
+	return (archiveFilename != NULL) ? *archiveFilename : AsciiString::TheEmptyString;
+}
+
+const AsciiString& ArchiveFileSystem::getArchiveFilenameFromTree(const AsciiString& filename) const
 {
 	AsciiString path;
 	path = filename;
@@ -320,3 +494,121 @@ void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirecto
 		it++;
 	}
 }
+
+// TheSuperHackers @performance alanblack166 18/10/2026 Opens every file of every archive file, including the ones that are
+// overridden by other archives, once to only open and close it and once to also read all of its data.
+// Then looks up every archived path the way a map load resolves its assets.
+// This measures the cost of the archive file backend independently of the rest of the engine.
+Int ArchiveFileSystem::benchmarkOpenAllFiles( void )
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+
+	std::vector<char> buffer(64 * 1024);
+
+	for (Int pass = 0; pass < 2; ++pass)
+	{
+		const Bool readData = (pass == 1);
+		Int numArchives = 0;
+		Int numFiles = 0;
+		Int numFailed = 0;
+		Int64 numBytes = 0;
+
+		LARGE_INTEGER startTime;
+		QueryPerformanceCounter(&startTime);
+
+		for (ArchiveFileMap::iterator it = m_archiveFileMap.begin(); it != m_archiveFileMap.end(); ++it)
+		{
+			ArchiveFile *archiveFile = it->second;
+			FilenameList filenameList;
+			archiveFile->getFileListInDirectory(AsciiString(""), AsciiString(""), AsciiString("*"), filenameList, TRUE);
+			++numArchives;
+
+			for (FilenameListIter fileIt = filenameList.begin(); fileIt != filenameList.end(); ++fileIt)
+			{
+				File *file = archiveFile->openFile(fileIt->str());
+				if (file == NULL)
+				{
+					++numFailed;
+					continue;
+				}
+
+				if (readData)
+				{
+					Int bytesRead;
+					while ((bytesRead = file->read(&buffer[0], (Int)buffer.size())) > 0)
+						numBytes += bytesRead;
+				}
+				else
+				{
+					numBytes += file->size();
+				}
+
+				file->close();
+				++numFiles;
+			}
+		}
+
+		LARGE_INTEGER endTime;
+		QueryPerformanceCounter(&endTime);
+		const double ms = (double)(endTime.QuadPart - startTime.QuadPart) * 1000.0 / (double)freq.QuadPart;
+
+		printf("%s: %d archives, %d files, %d failed, %.1f MB in %.1f ms (%.2f us per file)\n",
+			readData ? "Open, read and close" : "Open and close",
+			numArchives, numFiles, numFailed, (double)numBytes / (1024.0 * 1024.0), ms,
+			numFiles > 0 ? ms * 1000.0 / numFiles : 0.0);
+		DEBUG_LOG(("ArchiveFileSystem::benchmarkOpenAllFiles - %s: %d files, %d failed, %.1f ms",
+			readData ? "open, read and close" : "open and close", numFiles, numFailed, ms));
+
+		if (numFailed > 0)
+			return 1;
+	}
+
+	// Look up every archived file through the path index and through the directory tree,
+	// and check that both find the same archive file.
+	FilenameList filenameList;
+	getFileListInDirectory(AsciiString(""), AsciiString(""), AsciiString("*"), filenameList, TRUE);
+	const std::vector<AsciiString> paths(filenameList.begin(), filenameList.end());
+	const Int numRounds = 10;
+	Int numMismatches = 0;
+	double lookupsPerSecond[2] = { 0.0, 0.0 };
+
+	for (Int pass = 0; pass < 2; ++pass)
+	{
+		const Bool useTree = (pass == 1);
+		Int numFound = 0;
+
+		LARGE_INTEGER startTime;
+		QueryPerformanceCounter(&startTime);
+
+		for (Int round = 0; round < numRounds; ++round)
+		{
+			for (std::vector<AsciiString>::const_iterator it = paths.begin(); it != paths.end(); ++it)
+			{
+				const AsciiString &archiveFilename = useTree ? getArchiveFilenameFromTree(*it) : lookupArchiveFilename(it->str());
+				if (archiveFilename.isNotEmpty())
+					++numFound;
+			}
+		}
+
+		LARGE_INTEGER endTime;
+		QueryPerformanceCounter(&endTime);
+		const double seconds = max((double)(endTime.QuadPart - startTime.QuadPart) / (double)freq.QuadPart, 1e-9);
+		lookupsPerSecond[pass] = (double)paths.size() * numRounds / seconds;
+		numMismatches += (Int)paths.size() * numRounds - numFound;
+	}
+
+	for (std::vector<AsciiString>::const_iterator it = paths.begin(); it != paths.end(); ++it)
+	{
+		if (lookupArchiveFilename(it->str()) != getArchiveFilenameFromTree(*it))
+		{
+			DEBUG_LOG(("ArchiveFileSystem::benchmarkOpenAllFiles - %s is found in different archive files", it->str()));
+			++numMismatches;
+		}
+	}
+
+	printf("Look up %d paths: %.0f lookups/s with the path index, %.0f lookups/s with the directory tree, %d mismatches\n",
+		(Int)paths.size(), lookupsPerSecond[0], lookupsPerSecond[1], numMismatches);
+
+	return (numMismatches > 0) ? 1 : 0;
+}
@@ -0,0 +1,244 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/CRCKernel.h"
+#include "Common/XferCRC.h"
+#include "utility/endian_compat.h"
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt CRCKernel::addBytes(UnsignedInt crc, const UnsignedByte *bytes, Int count)
+{
+	const UnsignedByte *end = bytes + count;
+
+	// After 8 steps the CRC is the CRC rotated by 8 plus the bytes shifted by their distance to the end
+	// of the block, unless one of the additions carries into the top bit. That carry is only possible
+	// when the bits 14 to 23 of the CRC at the start of the block are all set, which is rare. The block
+	// is then added one byte at a time. The sum of the bytes is built as a tree, so that its additions
+	// do not wait for each other or for the CRC.
+	while (end - bytes >= 8)
+	{
+		if ((crc & 0x00FFC000) != 0x00FFC000)
+		{
+			const UnsignedInt sum01 = ((UnsignedInt)bytes[0] << 1) + bytes[1];
+			const UnsignedInt sum23 = ((UnsignedInt)bytes[2] << 1) + bytes[3];
+			const UnsignedInt sum45 = ((UnsignedInt)bytes[4] << 1) + bytes[5];
+			const UnsignedInt sum67 = ((UnsignedInt)bytes[6] << 1) + bytes[7];
+			const UnsignedInt sum = (((sum01 << 2) + sum23) << 4) + ((sum45 << 2) + sum67);
+			crc = ((crc << 8) | (crc >> 24)) + sum;
+		}
+		else
+		{
+			for (Int i = 0; i < 8; ++i)
+				crc = addValue(crc, bytes[i]);
+		}
+
+		bytes += 8;
+	}
+
+	for (; bytes < end; ++bytes)
+		crc = addValue(crc, *bytes);
+
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt CRCKernel::addBigEndianWords(UnsignedInt crc, const UnsignedInt *words, Int count)
+{
+	for (; count >= 4; count -= 4, words += 4)
+	{
+		crc = addValue(crc, htobe(words[0]));
+		crc = addValue(crc, htobe(words[1]));
+		crc = addValue(crc, htobe(words[2]));
+		crc = addValue(crc, htobe(words[3]));
+	}
+
+	for (; count > 0; --count, ++words)
+		crc = addValue(crc, htobe(*words));
+
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+UnsignedInt CRCKernel::addValues(UnsignedInt crc, const UnsignedInt *values, Int count)
+{
+	for (; count >= 4; count -= 4, values += 4)
+	{
+		crc = addValue(crc, values[0]);
+		crc = addValue(crc, values[1]);
+		crc = addValue(crc, values[2]);
+		crc = addValue(crc, values[3]);
+	}
+
+	for (; count > 0; --count, ++values)
+		crc = addValue(crc, *values);
+
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+// The original loops, which the benchmark compares the kernels against.
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt referenceAddBytes(UnsignedInt crc, const UnsignedByte *bytes, Int count)
+{
+	for (Int i = 0; i < count; ++i)
+	{
+		int hibit;
+		if (crc & 0x80000000)
+			hibit = 1;
+		else
+			hibit = 0;
+
+		crc <<= 1;
+		crc += bytes[i];
+		crc += hibit;
+	}
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt referenceXfer(UnsignedInt crc, const UnsignedByte *data, Int dataSize)
+{
+	const UnsignedInt *uintPtr = (const UnsignedInt *)data;
+	for (Int i = 0; i < dataSize / 4; ++i)
+		crc = (crc << 1) + htobe(*uintPtr++) + ((crc >> 31) & 0x01);
+
+	UnsignedInt val = 0;
+	const unsigned char *c = (const unsigned char *)uintPtr;
+	switch (dataSize & 3)
+	{
+	case 3:
+		val += (c[2] << 16);
+		FALLTHROUGH;
+	case 2:
+		val += (c[1] << 8);
+		FALLTHROUGH;
+	case 1:
+		val += c[0];
+		crc = (crc << 1) + val + ((crc >> 31) & 0x01);
+		FALLTHROUGH;
+	default:
+		break;
+	}
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+static Int64 getKernelTicks()
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool reportKernel(const char *name, Int64 bytes, Int64 referenceTicks, Int64 kernelTicks, Int64 ticksPerSecond,
+	UnsignedInt referenceCRC, UnsignedInt kernelCRC)
+{
+	const double megabytes = (double)bytes / (1024.0 * 1024.0);
+	const double referenceSeconds = (double)referenceTicks / (double)ticksPerSecond;
+	const double kernelSeconds = (double)kernelTicks / (double)ticksPerSecond;
+	const Bool same = (referenceCRC == kernelCRC);
+
+	printf("%-28s original %8.1f MB/s, kernel %8.1f MB/s, %5.2fx, CRC 0x%8.8X %s 0x%8.8X\n", name,
+		referenceSeconds > 0.0 ? megabytes / referenceSeconds : 0.0,
+		kernelSeconds > 0.0 ? megabytes / kernelSeconds : 0.0,
+		kernelSeconds > 0.0 ? referenceSeconds / kernelSeconds : 0.0,
+		referenceCRC, same ? "==" : "!=", kernelCRC);
+	DEBUG_LOG(("CRCKernel::benchmark - %s: original %.1f ms, kernel %.1f ms, CRC 0x%8.8X %s 0x%8.8X", name,
+		referenceSeconds * 1000.0, kernelSeconds * 1000.0, referenceCRC, same ? "==" : "!=", kernelCRC));
+
+	return same;
+}
+
+//-------------------------------------------------------------------------------------------------
+// TheSuperHackers @performance alanblack166 18/10/2026 Hashes the same buffer with the original loops and with the kernels.
+// The XferCRC passes hash the buffer in pieces of a fixed size, like the lines of the INI CRC and
+// the small values of the logic CRC that the replays check.
+//-------------------------------------------------------------------------------------------------
+Int CRCKernel::benchmark()
+{
+	Int64 ticksPerSecond = 1;
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		ticksPerSecond = freq.QuadPart;
+
+	const Int size = 16 * 1024 * 1024;
+	const Int rounds = 4;
+
+	std::vector<UnsignedByte> data(size);
+	UnsignedInt seed = 0x1234567;
+	for (Int i = 0; i < size; ++i)
+	{
+		seed = seed * 1664525 + 1013904223;
+		data[i] = (UnsignedByte)(seed >> 24);
+	}
+
+	const Int64 totalBytes = (Int64)size * rounds;
+	Bool allSame = TRUE;
+
+	// CRC::computeCRC
+	{
+		UnsignedInt referenceCRC = 0;
+		Int64 startTicks = getKernelTicks();
+		for (Int round = 0; round < rounds; ++round)
+			referenceCRC = referenceAddBytes(referenceCRC, &data[0], size);
+		const Int64 referenceTicks = getKernelTicks() - startTicks;
+
+		UnsignedInt kernelCRC = 0;
+		startTicks = getKernelTicks();
+		for (Int round = 0; round < rounds; ++round)
+			kernelCRC = addBytes(kernelCRC, &data[0], size);
+		const Int64 kernelTicks = getKernelTicks() - startTicks;
+
+		allSame &= reportKernel("CRC bytes", totalBytes, referenceTicks, kernelTicks, ticksPerSecond, referenceCRC, kernelCRC);
+	}
+
+	// XferCRC, in pieces of different sizes
+	const Int pieceSizes[] = { 4, 15, 64, 4096 };
+	const Int pieceSizeCount = sizeof(pieceSizes) / sizeof(pieceSizes[0]);
+	for (Int p = 0; p < pieceSizeCount; ++p)
+	{
+		const Int pieceSize = pieceSizes[p];
+		const Int pieceCount = size / pieceSize;
+
+		UnsignedInt referenceCRC = 0;
+		Int64 startTicks = getKernelTicks();
+		for (Int round = 0; round < rounds; ++round)
+			for (Int piece = 0; piece < pieceCount; ++piece)
+				referenceCRC = referenceXfer(referenceCRC, &data[piece * pieceSize], pieceSize);
+		const Int64 referenceTicks = getKernelTicks() - startTicks;
+
+		XferCRC xferCRC;
+		xferCRC.open("CRCKernelBenchmark");
+		startTicks = getKernelTicks();
+		for (Int round = 0; round < rounds; ++round)
+			for (Int piece = 0; piece < pieceCount; ++piece)
+				xferCRC.xferUser(&data[piece * pieceSize], pieceSize);
+		const Int64 kernelTicks = getKernelTicks() - startTicks;
+		xferCRC.close();
+
+		AsciiString name;
+		name.format("XferCRC %d byte pieces", pieceSize);
+		allSame &= reportKernel(name.str(), (Int64)pieceCount * pieceSize * rounds, referenceTicks, kernelTicks, ticksPerSecond,
+			htobe(referenceCRC), xferCRC.getCRC());
+	}
+
+	return allSame ? 0 : 1;
+}
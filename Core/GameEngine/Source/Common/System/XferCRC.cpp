@@ -33,6 +33,7 @@
 #include "Common/XferCRC.h"
 #include "Common/XferDeepCRC.h"
 #include "Common/crc.h"
+#include "Common/CRCKernel.h"
 #include "Common/Snapshot.h"
 #include "utility/endian_compat.h"
 
@@ -130,10 +131,9 @@ void XferCRC::xferImplementation( void *data, Int dataSize )
 
 	int dataBytes = (dataSize / 4);
 
-	for (Int i=0 ; i<dataBytes; ++i)
-	{
-		addCRC (*uintPtr++);
-	}
+	// TheSuperHackers @performance alanblack166 18/10/2026 The words of the whole block go through the CRC kernel in one go.
+	m_crc = CRCKernel::addBigEndianWords( m_crc, uintPtr, dataBytes );
+	uintPtr += dataBytes;
 
 	UnsignedInt val = 0;
 	const unsigned char *c = (const unsigned char *)uintPtr;
@@ -173,6 +173,152 @@ UnsignedInt XferCRC::getCRC( void )
 }  // end skip
 
 
+//-------------------------------------------------------------------------------------------------
+/** An XferCRC that also stores every value it adds to the CRC, for XferCRCSegmentCache */
+//-------------------------------------------------------------------------------------------------
+class XferCRCRecorder : public XferCRC
+{
+
+public:
+
+	XferCRCRecorder( std::vector<UnsignedInt> *values ) : m_values( values ) { }
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize );
+
+	inline void addValue( UnsignedInt value )
+	{
+		m_values->push_back( value );
+		m_crc = CRCKernel::addValue( m_crc, value );
+	}
+
+	std::vector<UnsignedInt> *m_values;
+
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Same as XferCRC::xferImplementation, see there */
+//-------------------------------------------------------------------------------------------------
+void XferCRCRecorder::xferImplementation( void *data, Int dataSize )
+{
+	const UnsignedInt *uintPtr = (const UnsignedInt *) (data);
+	dataSize *= (data != NULL);
+
+	int dataBytes = (dataSize / 4);
+
+	for (Int i=0 ; i<dataBytes; ++i)
+	{
+		addValue (htobe(*uintPtr++));
+	}
+
+	UnsignedInt val = 0;
+	const unsigned char *c = (const unsigned char *)uintPtr;
+
+	switch(dataSize & 3)
+	{
+	case 3:
+		val += (c[2] << 16);
+		FALLTHROUGH;
+	case 2:
+		val += (c[1] << 8);
+		FALLTHROUGH;
+	case 1:
+		val += c[0];
+		addValue (val);
+		FALLTHROUGH;
+	default:
+		break;
+	}
+
+}  // end xferImplementation
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferCRCSegmentCache::reset( Int segmentCount )
+{
+
+	m_segments.clear();
+	m_segments.resize( segmentCount );
+	markAllDirty();
+
+}  // end reset
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferCRCSegmentCache::markAllDirty( void )
+{
+
+	for( size_t i = 0; i < m_segments.size(); ++i )
+		m_segments[ i ].dirty = TRUE;
+
+}  // end markAllDirty
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferCRCSegmentCache::crc( XferCRC *xfer, SegmentProc proc, void *userData )
+{
+
+#ifdef RTS_DEBUG
+	// the full walk, to verify that the owner marks all changes
+	XferCRC fullXfer;
+	fullXfer.open( "XferCRCSegmentCacheCheck" );
+	fullXfer.m_crc = xfer->m_crc;
+	for( Int i = 0; i < getSegmentCount(); ++i )
+		proc( &fullXfer, i, userData );
+	fullXfer.close();
+#endif
+
+	UnsignedInt crc = xfer->m_crc;
+	for( size_t i = 0; i < m_segments.size(); ++i )
+	{
+		Segment &segment = m_segments[ i ];
+
+		if( segment.dirty )
+		{
+
+			// walk the snapshots and keep the values they add
+			segment.values.clear();
+			XferCRCRecorder recorder( &segment.values );
+			recorder.open( "XferCRCSegmentCache" );
+			recorder.m_crc = crc;
+			proc( &recorder, (Int)i, userData );
+			recorder.close();
+
+			segment.crcBefore = crc;
+			crc = recorder.m_crc;
+			segment.crcAfter = crc;
+			segment.dirty = FALSE;
+
+		}  // end if
+		else if( segment.crcBefore == crc )
+		{
+
+			// nothing before or in this segment changed
+			crc = segment.crcAfter;
+
+		}  // end else if
+		else
+		{
+
+			segment.crcBefore = crc;
+			if( !segment.values.empty() )
+				crc = CRCKernel::addValues( crc, &segment.values[ 0 ], (Int)segment.values.size() );
+			segment.crcAfter = crc;
+
+		}  // end else
+
+	}  // end for i
+
+	xfer->m_crc = crc;
+
+#ifdef RTS_DEBUG
+	DEBUG_ASSERTCRASH( fullXfer.m_crc == crc, ("XferCRCSegmentCache - cached CRC 0x%8.8X differs from full CRC 0x%8.8X, a change was not marked",
+																						 crc, fullXfer.m_crc) );
+#endif
+
+}  // end crc
+
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
 XferDeepCRC::XferDeepCRC( void )
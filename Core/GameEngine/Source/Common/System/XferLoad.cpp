@@ -33,6 +33,8 @@
 #include "Common/GameState.h"
 #include "Common/Snapshot.h"
 #include "Common/XferLoad.h"
+#include "Common/XferSave.h"
+#include "Compression.h"
 
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
@@ -41,6 +43,9 @@ XferLoad::XferLoad( void )
 
 	m_xferMode = XFER_LOAD;
 	m_fileFP = NULL;
+	m_bufferData = NULL;
+	m_bufferSize = 0;
+	m_bufferPos = 0;
 
 }  // end XferLoad
 
@@ -50,7 +55,7 @@ XferLoad::~XferLoad( void )
 {
 
 	// warn the user if a file was left open
-	if( m_fileFP != NULL )
+	if( isOpen() )
 	{
 
 		DEBUG_CRASH(( "Warning: Xfer file '%s' was left open", m_identifier.str() ));
@@ -61,13 +66,14 @@ XferLoad::~XferLoad( void )
 }  // end ~XferLoad
 
 //-------------------------------------------------------------------------------------------------
-/** Open file 'identifier' for reading */
+/** Open file 'identifier' for reading. TheSuperHackers @feature alanblack166 18/10/2026 A file compressed by XferSave
+	* is decompressed into memory here and then read like a buffer. */
 //-------------------------------------------------------------------------------------------------
 void XferLoad::open( AsciiString identifier )
 {
 
 	// sanity, check to see if we're already open
-	if( m_fileFP != NULL )
+	if( isOpen() )
 	{
 
 		DEBUG_CRASH(( "Cannot open file '%s' cause we've already got '%s' open",
@@ -79,6 +85,9 @@ void XferLoad::open( AsciiString identifier )
 	// call base class
 	Xfer::open( identifier );
 
+	// the file may still be written by the save writer thread
+	XferSave::waitForPendingWrites();
+
 	// open the file
 	m_fileFP = fopen( identifier.str(), "rb" );
 	if( m_fileFP == NULL )
@@ -89,8 +98,77 @@ void XferLoad::open( AsciiString identifier )
 
 	}  // end if
 
+	// uncompressed files are read directly
+	UnsignedByte header[ 8 ];
+	if( fread( header, sizeof( header ), 1, m_fileFP ) != 1 ||
+			CompressionManager::isDataCompressed( header, sizeof( header ) ) == FALSE )
+	{
+		rewind( m_fileFP );
+		return;
+	}
+
+	fseek( m_fileFP, 0, SEEK_END );
+	const Int compressedSize = (Int)ftell( m_fileFP );
+	rewind( m_fileFP );
+
+	std::vector<UnsignedByte> compressed( compressedSize );
+	const Bool readAll = fread( &compressed[ 0 ], compressedSize, 1, m_fileFP ) == 1;
+	fclose( m_fileFP );
+	m_fileFP = NULL;
+
+	const Int uncompressedSize = CompressionManager::getUncompressedSize( &compressed[ 0 ], compressedSize );
+	if( readAll && uncompressedSize > 0 )
+	{
+		m_fileData.resize( uncompressedSize );
+		if( CompressionManager::decompressData( &compressed[ 0 ], compressedSize, &m_fileData[ 0 ], uncompressedSize ) == uncompressedSize )
+		{
+			m_bufferData = &m_fileData[ 0 ];
+			m_bufferSize = uncompressedSize;
+			m_bufferPos = 0;
+			return;
+		}
+	}
+
+	std::vector<UnsignedByte>().swap( m_fileData );
+	DEBUG_CRASH(( "Cannot decompress file '%s'", identifier.str() ));
+	throw XFER_READ_ERROR;
+
 }  // end open
 
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature alanblack166 18/10/2026 Open memory buffer for reading. The buffer must contain data written
+	* by XferSave and must stay valid until close is called. */
+//-------------------------------------------------------------------------------------------------
+void XferLoad::openBuffer( AsciiString identifier, const UnsignedByte *data, UnsignedInt dataSize )
+{
+
+	// sanity, check to see if we're already open
+	if( isOpen() )
+	{
+
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}  // end if
+
+	if( data == NULL )
+	{
+
+		DEBUG_CRASH(( "XferLoad::openBuffer - Invalid parameters" ));
+		throw XFER_INVALID_PARAMETERS;
+
+	}  // end if
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_bufferData = data;
+	m_bufferSize = dataSize;
+	m_bufferPos = 0;
+
+}  // end openBuffer
+
 //-------------------------------------------------------------------------------------------------
 /** Close our current file */
 //-------------------------------------------------------------------------------------------------
@@ -98,7 +176,7 @@ void XferLoad::close( void )
 {
 
 	// sanity, if we don't have an open file we can do nothing
-	if( m_fileFP == NULL )
+	if( !isOpen() )
 	{
 
 		DEBUG_CRASH(( "Xfer close called, but no file was open" ));
@@ -107,8 +185,17 @@ void XferLoad::close( void )
 	}  // end if
 
 	// close the file
-	fclose( m_fileFP );
-	m_fileFP = NULL;
+	if( m_fileFP != NULL )
+	{
+		fclose( m_fileFP );
+		m_fileFP = NULL;
+	}
+
+	// release the buffer, it belongs to the caller unless it holds a decompressed file
+	m_bufferData = NULL;
+	m_bufferSize = 0;
+	m_bufferPos = 0;
+	std::vector<UnsignedByte>().swap( m_fileData );
 
 	// erase the filename
 	m_identifier.clear();
@@ -122,12 +209,12 @@ Int XferLoad::beginBlock( void )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("Xfer begin block - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("Xfer begin block - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// read block size
 	XferBlockSize blockSize;
-	if( fread( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
+	if( !read( &blockSize, sizeof( XferBlockSize ) ) )
 	{
 		
 		DEBUG_CRASH(( "Xfer - Error reading block size for '%s'", m_identifier.str() ));
@@ -155,7 +242,7 @@ void XferLoad::skip( Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("XferLoad::skip - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("XferLoad::skip - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// sanity
@@ -163,7 +250,13 @@ void XferLoad::skip( Int dataSize )
 										 dataSize) );
 
 	// skip datasize in the file from the current position
-	if( fseek( m_fileFP, dataSize, SEEK_CUR ) != 0 )
+	if( m_bufferData != NULL )
+	{
+		if( dataSize < 0 || m_bufferPos + dataSize > m_bufferSize )
+			throw XFER_SKIP_ERROR;
+		m_bufferPos += dataSize;
+	}
+	else if( fseek( m_fileFP, dataSize, SEEK_CUR ) != 0 )
 		throw XFER_SKIP_ERROR;
 
 }  // end skip
@@ -244,11 +337,11 @@ void XferLoad::xferImplementation( void *data, Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("XferLoad - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("XferLoad - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// read data from file
-	if( fread( data, dataSize, 1, m_fileFP ) != 1 )
+	if( !read( data, dataSize ) )
 	{
 
 		DEBUG_CRASH(( "XferLoad - Error reading from file '%s'", m_identifier.str() ));
@@ -258,3 +351,24 @@ void XferLoad::xferImplementation( void *data, Int dataSize )
 	
 }  // end xferImplementation
 
+//-------------------------------------------------------------------------------------------------
+/** Read data from the current position in the file or buffer */
+//-------------------------------------------------------------------------------------------------
+Bool XferLoad::read( void *data, Int dataSize )
+{
+
+	if( m_bufferData != NULL )
+	{
+
+		if( dataSize < 0 || m_bufferPos + dataSize > m_bufferSize )
+			return FALSE;
+
+		memcpy( data, m_bufferData + m_bufferPos, dataSize );
+		m_bufferPos += dataSize;
+		return TRUE;
+
+	}  // end if
+
+	return fread( data, dataSize, 1, m_fileFP ) == 1;
+
+}  // end read
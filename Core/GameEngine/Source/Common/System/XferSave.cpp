@@ -33,6 +33,8 @@
 #include "Common/Snapshot.h"
 #include "Common/GameMemory.h"
 
+#include "thread.h"
+
 // PRIVATE TYPES //////////////////////////////////////////////////////////////////////////////////
 class XferBlockData : public MemoryPoolObject
 {
@@ -46,6 +48,122 @@ public:
 };
 EMPTY_DTOR(XferBlockData)
 
+//-------------------------------------------------------------------------------------------------
+static Int64 getXferTicks( void )
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter( &ticks );
+	return ticks.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+static double xferTicksToMs( Int64 ticks )
+{
+	LARGE_INTEGER freq;
+	if( !QueryPerformanceFrequency( &freq ) || freq.QuadPart <= 0 )
+		return 0.0;
+	return (double)ticks * 1000.0 / (double)freq.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance alanblack166 18/10/2026 Compresses the contents of a closed save file and writes them,
+	* so the main thread only has to serialize the game state into memory. The result is kept until
+	* XferSave::waitForPendingWrites collects it. */
+//-------------------------------------------------------------------------------------------------
+class XferSaveWriterThread : public ThreadClass
+{
+
+public:
+
+	XferSaveWriterThread( FILE *fileFP, AsciiString identifier, CompressionType compType, std::vector<UnsignedByte> &data ) :
+		ThreadClass( "XferSaveWriterThread" ),
+		m_fileFP( fileFP ),
+		m_identifier( identifier ),
+		m_compression( compType ),
+		m_written( FALSE ),
+		m_done( false )
+	{
+		m_data.swap( data );
+	}
+
+	Bool writeFile( void );		///< compress, write and close the file, returns FALSE on any error
+	Bool isDone( void ) const { return m_done; }
+	Bool hasWritten( void ) const { return m_written; }
+	const AsciiString& getIdentifier( void ) const { return m_identifier; }
+
+protected:
+
+	virtual void Thread_Function( void );
+
+private:
+
+	FILE *m_fileFP;
+	AsciiString m_identifier;
+	CompressionType m_compression;
+	std::vector<UnsignedByte> m_data;
+	Bool m_written;
+	volatile bool m_done;		///< set as the last thing, the thread does not touch this object afterwards
+
+};
+
+static XferSaveWriterThread *s_writerThread = NULL;
+static AsciiString s_writeErrorFilename;	///< last file the writer could not write, until takeWriteError reports it
+static size_t s_lastFileDataSize = 0;	///< size of the last compressed file before compression, to reserve memory
+
+//-------------------------------------------------------------------------------------------------
+void XferSaveWriterThread::Thread_Function( void )
+{
+	m_written = writeFile();
+
+	releaseMemoryPoolThreadCache();
+
+	m_done = true;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool XferSaveWriterThread::writeFile( void )
+{
+	const Int64 startTicks = getXferTicks();
+	const Int dataSize = (Int)m_data.size();
+
+	std::vector<UnsignedByte> compressed( CompressionManager::getMaxCompressedSize( dataSize, m_compression ) );
+	Int compressedSize = 0;
+	if( dataSize > 0 && !compressed.empty() )
+		compressedSize = CompressionManager::compressData( m_compression, &m_data[ 0 ], dataSize, &compressed[ 0 ], (Int)compressed.size() );
+
+	Bool written;
+	if( compressedSize > 0 )
+	{
+		written = fwrite( &compressed[ 0 ], compressedSize, 1, m_fileFP ) == 1;
+	}
+	else
+	{
+		// XferLoad reads uncompressed files too, so the file is still usable
+		DEBUG_LOG(( "XferSave - Cannot compress '%s' with %s, writing it uncompressed",
+								m_identifier.str(), CompressionManager::getCompressionNameByType( m_compression ) ));
+		written = dataSize == 0 || fwrite( &m_data[ 0 ], dataSize, 1, m_fileFP ) == 1;
+		compressedSize = dataSize;
+	}
+
+	if( fclose( m_fileFP ) != 0 )
+		written = FALSE;
+
+	m_fileFP = NULL;
+
+	if( written )
+		DEBUG_LOG(( "XferSave - Wrote '%s' in %.1f ms, %d bytes compressed to %d bytes with %s",
+								m_identifier.str(), xferTicksToMs( getXferTicks() - startTicks ), dataSize, compressedSize,
+								CompressionManager::getCompressionNameByType( m_compression ) ));
+	else
+		DEBUG_LOG(( "XferSave - Error writing to file '%s'", m_identifier.str() ));
+
+	// free the buffers here, so their blocks go back to the memory pools together with the thread cache
+	std::vector<UnsignedByte>().swap( compressed );
+	std::vector<UnsignedByte>().swap( m_data );
+
+	return written;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC METHDOS /////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,7 +175,11 @@ XferSave::XferSave( void )
 
 	m_xferMode = XFER_SAVE;
 	m_fileFP = NULL;
+	m_buffer = NULL;
+	m_bufferPos = 0;
 	m_blockStack = NULL;
+	m_compression = COMPRESSION_NONE;
+	m_openTicks = 0;
 
 }  // end XferSave
 
@@ -67,7 +189,7 @@ XferSave::~XferSave( void )
 {
 
 	// warn the user if a file was left open
-	if( m_fileFP != NULL )
+	if( isOpen() )
 	{
 
 		DEBUG_CRASH(( "Warning: Xfer file '%s' was left open", m_identifier.str() ));
@@ -101,13 +223,15 @@ XferSave::~XferSave( void )
 }  // end ~XferSave
 
 //-------------------------------------------------------------------------------------------------
-/** Open file 'identifier' for writing */
+/** Open file 'identifier' for writing. With a compression set, the file is only opened here,
+	* so errors are still reported right away. Its contents are collected in memory and close
+	* hands them to a background thread, which compresses and writes them. */
 //-------------------------------------------------------------------------------------------------
 void XferSave::open( AsciiString identifier )
 {
 
 	// sanity, check to see if we're already open
-	if( m_fileFP != NULL )
+	if( isOpen() )
 	{
 
 		DEBUG_CRASH(( "Cannot open file '%s' cause we've already got '%s' open",
@@ -119,6 +243,9 @@ void XferSave::open( AsciiString identifier )
 	// call base class
 	Xfer::open( identifier );
 
+	// a previous file may still be written to the same path
+	waitForPendingWrites();
+
 	// open the file
 	m_fileFP = fopen( identifier.str(), "w+b" );
 	if( m_fileFP == NULL )
@@ -129,8 +256,52 @@ void XferSave::open( AsciiString identifier )
 
 	}  // end if
 
+	m_openTicks = getXferTicks();
+
+	if( m_compression != COMPRESSION_NONE )
+	{
+		m_fileData.clear();
+		m_fileData.reserve( s_lastFileDataSize );
+		m_buffer = &m_fileData;
+		m_bufferPos = 0;
+	}
+
 }  // end open
 
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature alanblack166 18/10/2026 Open memory buffer for writing. The buffer is cleared and then
+	* receives the same bytes that would be written to a file. It is owned by the caller. */
+//-------------------------------------------------------------------------------------------------
+void XferSave::openBuffer( AsciiString identifier, std::vector<UnsignedByte> *buffer )
+{
+
+	// sanity, check to see if we're already open
+	if( isOpen() )
+	{
+
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}  // end if
+
+	if( buffer == NULL )
+	{
+
+		DEBUG_CRASH(( "XferSave::openBuffer - Invalid parameters" ));
+		throw XFER_INVALID_PARAMETERS;
+
+	}  // end if
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_buffer = buffer;
+	m_buffer->clear();
+	m_bufferPos = 0;
+
+}  // end openBuffer
+
 //-------------------------------------------------------------------------------------------------
 /** Close our current file */
 //-------------------------------------------------------------------------------------------------
@@ -138,7 +309,7 @@ void XferSave::close( void )
 {
 
 	// sanity, if we don't have an open file we can do nothing
-	if( m_fileFP == NULL )
+	if( !isOpen() )
 	{
 
 		DEBUG_CRASH(( "Xfer close called, but no file was open" ));
@@ -146,15 +317,90 @@ void XferSave::close( void )
 
 	}  // end if
 
-	// close the file
-	fclose( m_fileFP );
-	m_fileFP = NULL;
+	if( m_fileFP != NULL && m_buffer == &m_fileData )
+	{
+
+		// the writer thread compresses the file contents, writes them and closes the file
+		s_lastFileDataSize = m_fileData.size();
+		s_writerThread = NEW XferSaveWriterThread( m_fileFP, m_identifier, m_compression, m_fileData );
+		s_writerThread->Execute();
+		m_fileFP = NULL;
+
+		// the thread did not start, so write the file here instead
+		if( !s_writerThread->Is_Running() && !s_writerThread->isDone() )
+		{
+			if( !s_writerThread->writeFile() )
+				s_writeErrorFilename = m_identifier;
+			delete s_writerThread;
+			s_writerThread = NULL;
+		}
+
+		DEBUG_LOG(( "XferSave - Saved '%s' in %.1f ms on the main thread, %d bytes to compress",
+								m_identifier.str(), xferTicksToMs( getXferTicks() - m_openTicks ), (Int)s_lastFileDataSize ));
+
+	}  // end if
+	else if( m_fileFP != NULL )
+	{
+
+		// close the file
+		const Int fileSize = (Int)ftell( m_fileFP );
+		fclose( m_fileFP );
+		m_fileFP = NULL;
+
+		DEBUG_LOG(( "XferSave - Saved '%s' in %.1f ms on the main thread, %d bytes uncompressed",
+								m_identifier.str(), xferTicksToMs( getXferTicks() - m_openTicks ), fileSize ));
+
+	}  // end else if
+
+	// release the buffer, it belongs to the caller unless it held a compressed file
+	m_buffer = NULL;
+	m_bufferPos = 0;
 
 	// erase the filename
 	m_identifier.clear();
 
 }  // end close
 
+//-------------------------------------------------------------------------------------------------
+/** Block until the writer thread is done with the last compressed file. Everything that
+	* reads save files calls this first, through XferLoad::open. A file that could not be
+	* written is remembered for takeWriteError. */
+//-------------------------------------------------------------------------------------------------
+void XferSave::waitForPendingWrites( void )
+{
+
+	if( s_writerThread == NULL )
+		return;
+
+	while( !s_writerThread->isDone() )
+		ThreadClass::Sleep_Ms( 1 );
+
+	if( !s_writerThread->hasWritten() )
+		s_writeErrorFilename = s_writerThread->getIdentifier();
+
+	delete s_writerThread;
+	s_writerThread = NULL;
+
+}  // end waitForPendingWrites
+
+//-------------------------------------------------------------------------------------------------
+/** Wait for pending writes, then return TRUE and the name of the last compressed file that
+	* could not be written, if there is one. Each error is returned once. */
+//-------------------------------------------------------------------------------------------------
+Bool XferSave::takeWriteError( AsciiString *filename )
+{
+
+	waitForPendingWrites();
+
+	if( s_writeErrorFilename.isEmpty() )
+		return FALSE;
+
+	*filename = s_writeErrorFilename;
+	s_writeErrorFilename.clear();
+	return TRUE;
+
+}  // end takeWriteError
+
 //-------------------------------------------------------------------------------------------------
 /** Write a placeholder at the current location in the file and store this location
 	* internally.  The next endBlock that is called will back up to the most recently stored
@@ -166,15 +412,15 @@ Int XferSave::beginBlock( void )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("Xfer begin block - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("Xfer begin block - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// get the current file position so we can back up here for the next end block call
-	XferFilePos filePos = ftell( m_fileFP );
+	XferFilePos filePos = tell();
 
 	// write a placeholder
 	XferBlockSize blockSize = 0;
-	if( fwrite( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
+	if( !write( &blockSize, sizeof( XferBlockSize ) ) )
 	{
 		
 		DEBUG_CRASH(( "XferSave::beginBlock - Error writing block size in '%s'",
@@ -211,7 +457,7 @@ void XferSave::endBlock( void )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("Xfer end block - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("Xfer end block - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// sanity, make sure we have a block started
@@ -224,18 +470,18 @@ void XferSave::endBlock( void )
 	}  // end if
 
 	// save our current file position
-	XferFilePos currentFilePos = ftell( m_fileFP );
+	XferFilePos currentFilePos = tell();
 
 	// pop the block descriptor off the top of the block stack
 	XferBlockData *top = m_blockStack;
 	m_blockStack = m_blockStack->next;
 
 	// rewind the file to the block position
-	fseek( m_fileFP, top->filePos, SEEK_SET );
+	seek( top->filePos );
 
 	// write the size in bytes between the block position and what is our current file position
 	XferBlockSize blockSize = currentFilePos - top->filePos - sizeof( XferBlockSize );
-	if( fwrite( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
+	if( !write( &blockSize, sizeof( XferBlockSize ) ) )
 	{
 
 		DEBUG_CRASH(( "Error writing block size to file '%s'", m_identifier.str() ));
@@ -244,7 +490,7 @@ void XferSave::endBlock( void )
 	}  // end if
 
 	// place the file pointer back to the current position
-	fseek( m_fileFP, currentFilePos, SEEK_SET );
+	seek( currentFilePos );
 
 	// delete the block data as it's all used up now
 	deleteInstance(top);
@@ -258,12 +504,12 @@ void XferSave::skip( Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("XferSave - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("XferSave - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 
 	// skip forward dataSize bytes
-	fseek( m_fileFP, dataSize, SEEK_CUR );
+	seek( tell() + dataSize );
 
 }  // end skip
 
@@ -343,11 +589,11 @@ void XferSave::xferImplementation( void *data, Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != NULL, ("XferSave - file pointer for '%s' is NULL",
+	DEBUG_ASSERTCRASH( isOpen(), ("XferSave - file pointer for '%s' is NULL",
 										 m_identifier.str()) );
 
 	// write data to file
-	if( fwrite( data, dataSize, 1, m_fileFP ) != 1 )
+	if( !write( data, dataSize ) )
 	{
 
 		DEBUG_CRASH(( "XferSave - Error writing to file '%s'", m_identifier.str() ));
@@ -356,3 +602,62 @@ void XferSave::xferImplementation( void *data, Int dataSize )
 	}  // end if
 	
 }  // end xferImplementation
+
+//-------------------------------------------------------------------------------------------------
+/** Get the current write position in the file or buffer */
+//-------------------------------------------------------------------------------------------------
+XferFilePos XferSave::tell( void ) const
+{
+
+	if( m_buffer != NULL )
+		return m_bufferPos;
+
+	return ftell( m_fileFP );
+
+}  // end tell
+
+//-------------------------------------------------------------------------------------------------
+/** Set the current write position in the file or buffer */
+//-------------------------------------------------------------------------------------------------
+void XferSave::seek( XferFilePos pos )
+{
+
+	if( m_buffer != NULL )
+	{
+
+		// skipping past the end leaves zeroed bytes, like it does in a file
+		if( (size_t)pos > m_buffer->size() )
+			m_buffer->resize( pos, 0 );
+		m_bufferPos = pos;
+		return;
+
+	}  // end if
+
+	fseek( m_fileFP, pos, SEEK_SET );
+
+}  // end seek
+
+//-------------------------------------------------------------------------------------------------
+/** Write data at the current position in the file or buffer */
+//-------------------------------------------------------------------------------------------------
+Bool XferSave::write( const void *data, Int dataSize )
+{
+
+	if( m_buffer != NULL )
+	{
+
+		if( dataSize <= 0 )
+			return TRUE;
+
+		const size_t endPos = m_bufferPos + dataSize;
+		if( endPos > m_buffer->size() )
+			m_buffer->resize( endPos );
+		memcpy( &(*m_buffer)[ m_bufferPos ], data, dataSize );
+		m_bufferPos = endPos;
+		return TRUE;
+
+	}  // end if
+
+	return fwrite( data, dataSize, 1, m_fileFP ) == 1;
+
+}  // end write
@@ -35,6 +35,8 @@
 #include "Common/AsciiString.h"
 #include "Common/List.h"
 
+class StdFileMapping;
+
 class StdBIGFile : public ArchiveFile
 {
 	public:
@@ -51,8 +53,12 @@ class StdBIGFile : public ArchiveFile
 
 	protected:
 
+		StdFileMapping*	getMapping( void );
+
 		AsciiString		m_name;		///< BIG file name
 		AsciiString		m_path;		///< BIG file path
+		StdFileMapping	*m_mapping;		///< read only mapping of the BIG file, created on the first open
+		Bool					m_mappingFailed;	///< the BIG file could not be mapped, so files are copied instead
 };
 
 #endif // __STDBIGFILE_H
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+
+#include "Common/RAMFile.h"
+
+//===============================
+// StdFileMapping
+//===============================
+/**
+	* A read only memory mapping of a whole file. The mapping is reference counted,
+	* so that the files opened from it stay valid after their archive was closed.
+	*/
+//===============================
+
+class StdFileMapping
+{
+	public:
+
+		static StdFileMapping *create( const Char *path );	///< Map the given file, returns NULL on failure
+
+		void					addRef( void );
+		void					release( void );											///< Unmaps and deletes the mapping with the last reference
+
+		const Char*		getData( void ) const { return m_data; }
+		Int						getSize( void ) const { return m_size; }
+
+	private:
+
+		StdFileMapping();
+		~StdFileMapping();
+
+		std::atomic<Int>	m_refCount;
+		const Char				*m_data;
+		Int								m_size;
+#ifdef _WIN32
+		void							*m_fileHandle;
+		void							*m_mappingHandle;
+#endif
+};
+
+//===============================
+// StdMappedFile
+//===============================
+/**
+	* RAMFile that reads straight from a file mapping instead of its own copy of the data.
+	*/
+//===============================
+
+class StdMappedFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(StdMappedFile, "StdMappedFile")
+	protected:
+
+		StdFileMapping	*m_mapping;										///< The mapping that m_data points into
+
+	public:
+
+		StdMappedFile();
+		//virtual				~StdMappedFile();
+
+		virtual void	close( void );
+		virtual Bool	openFromMapping( StdFileMapping *mapping, const AsciiString& filename, Int offset, Int size ); ///< view the given range of the mapping, without copying it.
+
+		virtual char* readEntireAndClose();
+
+	protected:
+
+		void releaseMapping();
+};
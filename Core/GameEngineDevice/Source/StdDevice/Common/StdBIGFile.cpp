@@ -33,12 +33,15 @@
 #include "Common/GameMemory.h"
 #include "Common/PerfTimer.h"
 #include "StdDevice/Common/StdBIGFile.h"
+#include "StdDevice/Common/StdMappedFile.h"
 
 //============================================================================
 // StdBIGFile::StdBIGFile
 //============================================================================
 
 StdBIGFile::StdBIGFile()
+: m_mapping(NULL),
+	m_mappingFailed(FALSE)
 {
 
 }
@@ -49,7 +52,11 @@ StdBIGFile::StdBIGFile()
 
 StdBIGFile::~StdBIGFile()
 {
-
+	// files that are still open keep their own reference to the mapping.
+	if (m_mapping != NULL) {
+		m_mapping->release();
+		m_mapping = NULL;
+	}
 }
 
 //============================================================================
@@ -66,16 +73,32 @@ File* StdBIGFile::openFile( const Char *filename, Int access )
 
 	RAMFile *ramFile = NULL;
 	
-	if (BitIsSet(access, File::STREAMING)) 
-		ramFile = newInstance( StreamingArchiveFile );
-	else 
-		ramFile = newInstance( RAMFile );
-
-	ramFile->deleteOnClose();
-	if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
-		ramFile->close();
-		ramFile = NULL;
-		return NULL;
+	// TheSuperHackers @performance alanblack166 18/10/2026 Files are read straight from a mapping of the BIG file when possible,
+	// instead of allocating and copying a RAMFile for each open.
+	StdFileMapping *mapping = BitIsSet(access, File::STREAMING) ? NULL : getMapping();
+	if (mapping != NULL)
+	{
+		StdMappedFile *mappedFile = newInstance( StdMappedFile );
+		mappedFile->deleteOnClose();
+		if (mappedFile->openFromMapping(mapping, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+			mappedFile->close();
+			return NULL;
+		}
+		ramFile = mappedFile;
+	}
+	else
+	{
+		if (BitIsSet(access, File::STREAMING)) 
+			ramFile = newInstance( StreamingArchiveFile );
+		else 
+			ramFile = newInstance( RAMFile );
+
+		ramFile->deleteOnClose();
+		if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+			ramFile->close();
+			ramFile = NULL;
+			return NULL;
+		}
 	}
 
 	if ((access & File::WRITE) == 0) {
@@ -98,6 +121,20 @@ File* StdBIGFile::openFile( const Char *filename, Int access )
 	return localFile;
 }
 
+//============================================================================
+// StdBIGFile::getMapping
+//============================================================================
+
+StdFileMapping* StdBIGFile::getMapping( void )
+{
+	if (m_mapping == NULL && !m_mappingFailed && m_file != NULL) {
+		m_mapping = StdFileMapping::create(m_file->getName());
+		m_mappingFailed = (m_mapping == NULL);
+	}
+
+	return m_mapping;
+}
+
 //============================================================================
 // StdBIGFile::closeAllFiles
 //============================================================================
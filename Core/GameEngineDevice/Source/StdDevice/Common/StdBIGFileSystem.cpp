@@ -42,7 +42,35 @@
 #include "StdDevice/Common/StdBIGFileSystem.h"
 #include "Utility/endian_compat.h"
 
+#include <chrono>
+#include <vector>
+
 static const char *BIGFileIdentifier = "BIGF";
+static const Int BIGHeaderSize = 0x10;
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the number of bytes that the given number of directory entries take up,
+	* or -1 if they do not fit into the given data. */
+//-------------------------------------------------------------------------------------------------
+static Int getBIGDirectorySize(const char *directory, Int directorySize, Int numEntries)
+{
+	Int pos = 0;
+	for (Int i = 0; i < numEntries; ++i) {
+		// skip the offset and size of the entry.
+		pos += 8;
+		if (pos >= directorySize) {
+			return -1;
+		}
+
+		const char *pathEnd = (const char *)memchr(directory + pos, 0, directorySize - pos);
+		if (pathEnd == NULL) {
+			return -1;
+		}
+		pos = (Int)(pathEnd - directory) + 1;
+	}
+
+	return pos;
+}
 
 StdBIGFileSystem::StdBIGFileSystem() : ArchiveFileSystem() {
 }
@@ -86,8 +114,6 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 	Int archiveFileSize = 0;
 	Int numLittleFiles = 0;
 
-	ArchiveFile *archiveFile = NEW StdBIGFile;
-
 	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - opening BIG file %s", filename));
 
 	if (fp == NULL) {
@@ -95,46 +121,77 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 		return NULL;
 	}
 
-	AsciiString asciibuf;
-	char buffer[_MAX_PATH];
-	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
-	buffer[4] = 0;
-	if (strcmp(buffer, BIGFileIdentifier) != 0) {
+	// TheSuperHackers @performance alanblack166 18/10/2026 The header and the whole directory are read with one bulk read each
+	// and parsed in memory, instead of reading every entry field and path name character separately.
+	char header[BIGHeaderSize];
+	if (fp->read(header, BIGHeaderSize) != BIGHeaderSize || memcmp(header, BIGFileIdentifier, 4) != 0) {
 		DEBUG_CRASH(("Error reading BIG file identifier in file %s", filename));
 		fp->close();
 		fp = NULL;
 		return NULL;
 	}
 
-	// read in the file size.
-	fp->read(&archiveFileSize, 4);
+	// the archive size is little endian, the other header fields are big endian.
+	memcpy(&archiveFileSize, header + 4, 4);
+	memcpy(&numLittleFiles, header + 8, 4);
+	numLittleFiles = betoh(numLittleFiles);
+	Int directoryEnd = 0;
+	memcpy(&directoryEnd, header + 12, 4);
+	directoryEnd = betoh(directoryEnd);
 
 	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - size of archive file is %d bytes", archiveFileSize));
+	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - %d are contained in archive", numLittleFiles));
 
-//	char t;
+	// Every directory entry takes at least 9 bytes: the offset, the size and the terminator of its path name.
+	const Int maxDirectorySize = fp->size() - BIGHeaderSize;
+	if (maxDirectorySize < 0 || numLittleFiles < 0 || numLittleFiles > maxDirectorySize / 9) {
+		DEBUG_CRASH(("Invalid file count %d in BIG file %s", numLittleFiles, filename));
+		fp->close();
+		fp = NULL;
+		return NULL;
+	}
 
-	// read in the number of files contained in this BIG file.
-	// change the order of the bytes cause the file size is in reverse byte order for some reason.
-	fp->read(&numLittleFiles, 4);
-	numLittleFiles = betoh(numLittleFiles);
+	// The header stores where the directory ends. Some tools write a wrong value there,
+	// so the directory is read again with more data when it does not fit.
+	Int directorySize = directoryEnd - BIGHeaderSize;
+	if (directorySize <= 0 || directorySize > maxDirectorySize) {
+		directorySize = (numLittleFiles > maxDirectorySize / 64) ? maxDirectorySize : numLittleFiles * 64;
+	}
 
-	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - %d are contained in archive", numLittleFiles));
-//	for (Int i = 0; i < 2; ++i) {
-//		t = buffer[i];
-//		buffer[i] = buffer[(4-i)-1];
-//		buffer[(4-i)-1] = t;
-//	}
-
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
+	std::vector<char> directory;
+	for (;;) {
+		DEBUG_ASSERTCRASH(directorySize >= 0 && directorySize <= maxDirectorySize, ("bad directory size"));
+		directory.resize(directorySize + 1);
+		fp->seek(BIGHeaderSize, File::START);
+		if (fp->read(&directory[0], directorySize) != directorySize) {
+			DEBUG_CRASH(("Error reading the directory of BIG file %s", filename));
+			fp->close();
+			fp = NULL;
+			return NULL;
+		}
+
+		if (getBIGDirectorySize(&directory[0], directorySize, numLittleFiles) >= 0) {
+			break;
+		}
+
+		if (directorySize >= maxDirectorySize) {
+			DEBUG_CRASH(("The directory of BIG file %s is truncated", filename));
+			fp->close();
+			fp = NULL;
+			return NULL;
+		}
+		directorySize = (directorySize > maxDirectorySize / 2) ? maxDirectorySize : min(maxDirectorySize, max(directorySize * 2, 1024));
+	}
+
+	ArchiveFile *archiveFile = NEW StdBIGFile;
 	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
+	char *entry = &directory[0];
 
 	for (Int i = 0; i < numLittleFiles; ++i) {
 		Int filesize = 0;
 		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
+		memcpy(&fileOffset, entry, 4);
+		memcpy(&filesize, entry + 4, 4);
 
 		filesize = betoh(filesize);
 		fileOffset = betoh(fileOffset);
@@ -142,30 +199,26 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 		fileInfo->m_archiveFilename = archiveFileName;
 		fileInfo->m_offset = fileOffset;
 		fileInfo->m_size = filesize;
-		
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
-
-		Int filenameIndex = pathIndex;
-		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
+
+		// the path name of the file follows the sizes and is zero terminated.
+		char *pathName = entry + 8;
+		const Int pathLength = (Int)strlen(pathName);
+		entry = pathName + pathLength + 1;
+
+		Int filenameIndex = pathLength;
+		while ((filenameIndex >= 0) && (pathName[filenameIndex] != '\\') && (pathName[filenameIndex] != '/')) {
 			--filenameIndex;
 		}
 
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
+		fileInfo->m_filename = pathName + filenameIndex + 1;
 		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
+
+		pathName[filenameIndex + 1] = 0;
 
 		AsciiString path;
-		path = buffer;
+		path = pathName;
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
+//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s%s to archive file %s, file number %d", path.str(), fileInfo->m_filename.str(), fileInfo->m_archiveFilename.str(), i));
 
 		archiveFile->addFile(path, fileInfo);
 	}
@@ -215,6 +268,9 @@ Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fi
 	Bool actuallyAdded = FALSE;
 	FilenameListIter it = filenameList.begin();
 	while (it != filenameList.end()) {
+		// TheSuperHackers @performance alanblack166 18/10/2026 Time the mount of each archive, to find the ones that slow down the startup.
+		const std::chrono::steady_clock::time_point mountStart = std::chrono::steady_clock::now();
+
 		ArchiveFile *archiveFile = openArchiveFile((*it).str());
 
 		if (archiveFile != NULL) {
@@ -225,6 +281,9 @@ Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fi
 			actuallyAdded = TRUE;
 		}
 
+		const double mountMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mountStart).count();
+		DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - mounting %s took %.2f ms", (*it).str(), mountMs));
+
 		it++;
 	}
 
@@ -0,0 +1,227 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common/GameMemory.h"
+#include "StdDevice/Common/StdMappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//============================================================================
+// StdFileMapping::StdFileMapping
+//============================================================================
+
+StdFileMapping::StdFileMapping()
+: m_refCount(1),
+	m_data(NULL),
+	m_size(0)
+#ifdef _WIN32
+	, m_fileHandle(INVALID_HANDLE_VALUE),
+	m_mappingHandle(NULL)
+#endif
+{
+}
+
+//============================================================================
+// StdFileMapping::~StdFileMapping
+//============================================================================
+
+StdFileMapping::~StdFileMapping()
+{
+#ifdef _WIN32
+	if (m_data != NULL)
+		UnmapViewOfFile(m_data);
+	if (m_mappingHandle != NULL)
+		CloseHandle(m_mappingHandle);
+	if (m_fileHandle != INVALID_HANDLE_VALUE)
+		CloseHandle(m_fileHandle);
+#else
+	if (m_data != NULL)
+		munmap((void *)m_data, m_size);
+#endif
+}
+
+//============================================================================
+// StdFileMapping::create
+//============================================================================
+
+StdFileMapping *StdFileMapping::create( const Char *path )
+{
+	StdFileMapping *mapping = NEW StdFileMapping;
+
+#ifdef _WIN32
+	mapping->m_fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (mapping->m_fileHandle != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER fileSize;
+		// BIG files address their contents with 32 bit offsets, so larger files are not mapped.
+		if (GetFileSizeEx(mapping->m_fileHandle, &fileSize) && fileSize.QuadPart > 0 && fileSize.QuadPart <= 0x7fffffff)
+		{
+			mapping->m_mappingHandle = CreateFileMappingA(mapping->m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping->m_mappingHandle != NULL)
+			{
+				mapping->m_data = (const Char *)MapViewOfFile(mapping->m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+				mapping->m_size = (Int)fileSize.QuadPart;
+			}
+		}
+	}
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd >= 0)
+	{
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= 0x7fffffff)
+		{
+			void *data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			if (data != MAP_FAILED)
+			{
+				mapping->m_data = (const Char *)data;
+				mapping->m_size = (Int)st.st_size;
+			}
+		}
+		// the mapping keeps its own reference to the file.
+		::close(fd);
+	}
+#endif
+
+	if (mapping->m_data == NULL)
+	{
+		DEBUG_LOG(("StdFileMapping::create - could not map %s", path));
+		mapping->release();
+		return NULL;
+	}
+
+	return mapping;
+}
+
+//============================================================================
+// StdFileMapping::addRef
+//============================================================================
+
+void StdFileMapping::addRef( void )
+{
+	++m_refCount;
+}
+
+//============================================================================
+// StdFileMapping::release
+//============================================================================
+
+void StdFileMapping::release( void )
+{
+	if (--m_refCount == 0)
+		delete this;
+}
+
+//============================================================================
+// StdMappedFile::StdMappedFile
+//============================================================================
+
+StdMappedFile::StdMappedFile()
+: m_mapping(NULL)
+{
+}
+
+//============================================================================
+// StdMappedFile::~StdMappedFile
+//============================================================================
+
+StdMappedFile::~StdMappedFile()
+{
+	releaseMapping();
+}
+
+//============================================================================
+// StdMappedFile::openFromMapping
+//============================================================================
+
+Bool StdMappedFile::openFromMapping( StdFileMapping *mapping, const AsciiString& filename, Int offset, Int size )
+{
+	if (mapping == NULL) {
+		return FALSE;
+	}
+
+	if (offset < 0 || size < 0 || offset > mapping->getSize() - size) {
+		DEBUG_CRASH(("StdMappedFile::openFromMapping - %s lies outside of its archive", filename.str()));
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		return FALSE;
+	}
+
+	releaseMapping();
+	mapping->addRef();
+	m_mapping = mapping;
+
+	// The view is read only. RAMFile never writes to m_data, so the const can be dropped here.
+	m_data = const_cast<Char *>(mapping->getData() + offset);
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
+//============================================================================
+// StdMappedFile::close
+//============================================================================
+
+void StdMappedFile::close( void )
+{
+	releaseMapping();
+	RAMFile::close();
+}
+
+//============================================================================
+// StdMappedFile::readEntireAndClose
+//============================================================================
+
+char* StdMappedFile::readEntireAndClose()
+{
+	// The caller owns the returned buffer, so the mapped data needs to be copied here.
+	char *data = MSGNEW("RAMFILE") char [ m_size > 0 ? m_size : 1 ];
+	if (m_data != NULL && m_size > 0)
+		memcpy(data, m_data, m_size);
+
+	close();
+
+	return data;
+}
+
+//============================================================================
+// StdMappedFile::releaseMapping
+//============================================================================
+
+void StdMappedFile::releaseMapping()
+{
+	// m_data points into the mapping and must not be deleted by RAMFile.
+	m_data = NULL;
+	m_size = 0;
+
+	if (m_mapping != NULL) {
+		m_mapping->release();
+		m_mapping = NULL;
+	}
+}
@@ -84,6 +84,12 @@ void ThreadClass::Execute()
 		return;
 	#else
 		handle=_beginthread(&Internal_Thread_Function,0,this);
+		// TheSuperHackers @bugfix alanblack166 18/10/2026 _beginthread returns -1 on failure, report the thread as not running.
+		if (handle==(unsigned long)-1) {
+			handle=0;
+			WWDEBUG_SAY(("ThreadClass::Execute: Cannot start thread %s", ThreadName));
+			return;
+		}
 		SetThreadPriority((HANDLE)handle,THREAD_PRIORITY_NORMAL+thread_priority);
 		WWDEBUG_SAY(("ThreadClass::Execute: Started thread %s, thread ID is %X", ThreadName, handle));
 	#endif
@@ -37,6 +37,7 @@
 #include "Common/STLTypedefs.h"
 #include "Common/AsciiString.h"
 #include "Common/GameCommon.h"
+#include "Common/INICache.h"
 
 //-------------------------------------------------------------------------------------------------
 class INI;
@@ -175,6 +176,7 @@ public:
 
 	void loadDirectory( AsciiString dirName, Bool subdirs, INILoadType loadType, Xfer *pXfer );  ///< load directory of INI files
 	void load( AsciiString filename, INILoadType loadType, Xfer *pXfer );		///< load INI file
+	static void tokenizeLines( const char *filename, const char *text, Int size, std::vector<char> &lines ); ///< split INI text into the lines readLine produces
 
 	static Bool isDeclarationOfType( AsciiString blockType, AsciiString blockName, char *bufferToCheck );
 	static Bool isEndOfBlock( char *bufferToCheck );
@@ -386,6 +388,8 @@ protected:
 	void unPrepFile();
 
 	void readLine( void );
+	void prepCachedLines( void );
+	void replayCachedLine( void );
 
 //	FILE *m_file;															///< file pointer of file currently loading
 	File *m_file;															///< file pointer of file currently loading
@@ -399,6 +403,13 @@ protected:
 	const char *m_sepsQuote;									///< token to represent a quoted ascii string
 	const char *m_blockEndToken;							///< token to represent end of data block
 	Bool m_endOfFile;													///< TRUE when we've hit EOF
+
+	const char *m_cachedLine;									///< next line to replay from the INI cache, or NULL
+	const char *m_cachedLinesEnd;							///< end of the cached lines of the current file
+	Bool m_recordLines;												///< TRUE when the lines of the current file are recorded for the INI cache
+	std::vector<char> m_recordedLines;				///< lines of the current file in the INI cache format
+	INICache::Source m_source;								///< where the current file comes from, for the INI cache
+	std::vector<char> m_prefetchedLines;			///< lines of the current file from the INI prefetcher
 #ifdef DEBUG_CRASHING
 	char m_curBlockStart[ INI_MAX_CHARS_PER_LINE ];	///< first line of cur block
 #endif
@@ -32,6 +32,7 @@
 #define _CRC_H_
 
 #include "Lib/BaseType.h"
+#include "Common/CRCKernel.h"
 
 #ifdef RTS_DEBUG
 
@@ -74,45 +75,9 @@ public:
     if (!buf||len<1)
       return;
     
-#if !(defined(_MSC_VER) && _MSC_VER < 1300)
-    // C++ version left in for reference purposes
-	  for (UnsignedByte *uintPtr=(UnsignedByte *)buf;len>0;len--,uintPtr++)
-    {
-    	int hibit;
-    	if (crc & 0x80000000) 
-      {
-		    hibit = 1;
-	    } 
-      else 
-      {
-		    hibit = 0;
-	    }
-
-	    crc <<= 1;
-	    crc += *uintPtr;
-	    crc += hibit;
-    }
-#else
-    // ASM version, verified by comparing resulting data with C++ version data
-    unsigned *crcPtr=&crc;
-    _asm
-    {
-      mov esi,[buf]
-      mov ecx,[len]
-      dec ecx
-      mov edi,[crcPtr]
-      mov ebx,dword ptr [edi]
-      xor eax,eax
-    lp:
-      mov al,byte ptr [esi]
-      shl ebx,1
-      inc esi
-      adc ebx,eax
-      dec ecx
-      jns lp
-      mov dword ptr [edi],ebx
-    };
-#endif
+    // TheSuperHackers @performance alanblack166 18/10/2026 The kernel adds 8 bytes at once and produces the same CRC as the
+    // original byte loop and its assembly version.
+    crc = CRCKernel::addBytes(crc, (const UnsignedByte *)buf, len);
   }
 
   /// Clears the CRC to 0
@@ -789,6 +789,10 @@ public:
 	// these are only for use by partcle systems to link and unlink themselves
 	void friend_addParticleSystem( ParticleSystem *particleSystemToAdd );
 	void friend_removeParticleSystem( ParticleSystem *particleSystemToRemove );
+	void friend_changeParticleSystemID( ParticleSystem *particleSystem, ParticleSystemID oldID );
+
+	/// Creates, updates and looks up many particle systems without a map, prints the timings and returns an exit code
+	Int benchmark( void );
 
 protected:
 
@@ -797,12 +801,27 @@ protected:
 	virtual void xfer( Xfer *xfer );
 	virtual void loadPostProcess( void );
 
+	void updateSystems( void );
+
+	// use special class for hashing, since std::hash won't compile for enums
+	struct hashParticleSystemID
+	{
+		size_t operator()(ParticleSystemID id) const
+		{
+			std::hash<UnsignedInt> hasher;
+			return hasher((UnsignedInt)id);
+		}
+	};
+
+	typedef std::hash_map< ParticleSystemID, ParticleSystemListIt, hashParticleSystemID, std::equal_to<ParticleSystemID> > ParticleSystemIDMap;
+
 	Particle *m_allParticlesHead[ NUM_PARTICLE_PRIORITIES ];
 	Particle *m_allParticlesTail[ NUM_PARTICLE_PRIORITIES ];
 
 	ParticleSystemID m_uniqueSystemID;					///< unique system ID to assign to each system created
 
 	ParticleSystemList m_allParticleSystemList;
+	ParticleSystemIDMap m_allParticleSystemsByID;	///< TheSuperHackers @performance alanblack166 18/10/2026 The entry of every system in m_allParticleSystemList by its ID
 
 	UnsignedInt m_particleCount;
 	UnsignedInt m_fieldParticleCount; ///< this does not need to be xfered, since it is evaluated every frame
@@ -39,6 +39,8 @@
 
 class Bridge;
 class Object;
+class Player;
+class ThingTemplate;
 class Weapon;
 class PathfindZoneManager;
 
@@ -440,6 +442,27 @@ private:
 
 enum { PATHFIND_QUEUE_LEN=512};
 
+/// The classes of queued pathfind requests, in the order in which they are served.
+enum PathfindRequestPriority CPP_11(: Int)
+{
+	PATHFIND_PRIORITY_PLAYER,			///< Request of a unit controlled by a human player
+	PATHFIND_PRIORITY_AI,					///< Request of a unit controlled by a computer player
+	PATHFIND_PRIORITY_REPATH,			///< Delayed request of a unit that asked for paths too quickly
+
+	PATHFIND_PRIORITY_COUNT
+};
+
+/// Statistics of the pathfind queue, as of the last processPathfindQueue().
+struct PathfindQueueStats
+{
+	Int						queueDepth;															///< Requests waiting in the queue
+	Int						queueDepthByPriority[PATHFIND_PRIORITY_COUNT];
+	Int						pathsLastFrame;													///< Requests served
+	Int						sharedPathsLastFrame;										///< Requests served with the path of a group mate
+	Real					avgLatencyLastFrame;										///< Average logic frames the served requests waited
+	UnsignedInt		maxLatencyLastFrame;										///< Most logic frames a served request waited
+};
+
 struct TCheckMovementInfo;
 
 /** 
@@ -461,6 +484,9 @@ public:
 	Bool isPassable(void) {return m_markedPassable;}
 	void setPassable(Bool pass) {m_markedPassable = pass;}
 
+	Bool isInCorridor(void) const {return m_inCorridor;}
+	void setInCorridor(Bool inCorridor) {m_inCorridor = inCorridor;}
+
 	Bool getInteractsWithBridge(void) const {return m_interactsWithBridge;}
 	void setInteractsWithBridge(Bool interacts) {m_interactsWithBridge = interacts;}
 
@@ -482,6 +508,7 @@ protected:
 	zoneStorageType *m_crusherZones;
 	Bool					m_interactsWithBridge;
 	Bool					m_markedPassable;
+	Bool					m_inCorridor;
 };
 typedef ZoneBlock *ZoneBlockP;
 
@@ -523,6 +550,9 @@ public:
 
 	void setAllPassable(void);
 
+	Bool markCorridorFromPassable(void);	///< Marks the passable blocks and the blocks around them as the search corridor.
+	Bool isInCorridor(Int cellX, Int cellY) const;
+
 	void setBridge(Int cellX, Int cellY, Bool bridge);
 	Bool interactsWithBridge(Int cellX, Int cellY) const;
 
@@ -535,6 +565,11 @@ protected:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
 	ZoneBlock			**m_zoneBlocks;						///< Zone blocks as a matrix - contains matrix indexing into the map.
 	ICoord2D			m_zoneBlockExtent;				///< Zone block extents. Not the same scale as the pathfind extents.
+	ICoord2D			*m_passableBlockList;			///< Blocks marked passable since the last clearPassableFlags.
+	Int						m_passableBlockCount;
+	Bool					m_allBlocksPassable;			///< True if blocks may be marked passable that are not in m_passableBlockList.
+	ICoord2D			*m_corridorBlockList;			///< Blocks marked as the search corridor.
+	Int						m_corridorBlockCount;
 
 	UnsignedShort m_maxZone;								///< Max zone used.
 	Bool					m_needToCalculateZones;		///< True if terrain has changed.
@@ -621,8 +656,9 @@ public:
 	Bool slowDoesPathExist( Object *obj, const Coord3D *from, 
 		const Coord3D *to, ObjectID ignoreObject=INVALID_ID );  ///< Can we build any path at all between the locations	(terrain, buildings & units check - slower)
 
-	Bool queueForPath(ObjectID id);	 ///< The object wants to request a pathfind, so put it on the list to process.
+	Bool queueForPath(ObjectID id, Bool isRepath = FALSE);	 ///< The object wants to request a pathfind, so put it on the list to process.
 	void processPathfindQueue(void); ///< Process some or all of the queued pathfinds.
+	void getQueueStats(PathfindQueueStats &stats) const;	///< Get the pathfind queue statistics.
 	void forceMapRecalculation( );	///< Force pathfind map recomputation. If region is given, only that area is recomputed
 
 	/** Returns an aircraft path to the goal.  */
@@ -823,6 +859,30 @@ protected:
 	void doDebugIcons(void) ;
 #endif
 
+	PathfindRequestPriority getRequestPriority(const Object *obj, Bool isRepath) const;
+	void processQueuedPathfind(Int slot);	///< Serve the request in the given queue slot.
+	void compactPathfindQueue(void);			///< Remove the served requests from the middle of the queue.
+
+	/// The request properties that must match for group mates to share a path.
+	struct SharedGroupPathKey
+	{
+		UnsignedInt								frame;						///< Logic frame in which the path was found
+		UnsignedInt								groupID;
+		const ThingTemplate				*thingTemplate;
+		const Player							*player;
+		LocomotorSurfaceTypeMask	surfaces;
+		ObjectID									ignoreObstacleID;
+		ICoord2D									startCell;
+		PathfindLayerEnum					startLayer;
+		Coord3D										goal;							///< Exact destination, so that each unit keeps its own goal
+	};
+	Bool makeSharedGroupPathKey(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
+		const Coord3D *to, SharedGroupPathKey &key);
+	Path *findSharedGroupPath(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to);
+	void rememberSharedGroupPath(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to, Path *path);
+	void releaseSharedGroupPath(void);
+	Path *copyPathFrom(Path *source, const Coord3D *from);	///< Copy a path, replacing its start with the given position.
+
 private:
 	/// This uses WAY too much memory.  Should at least be array of pointers to cells w/ many fewer cells
 	PathfindCell *m_blockOfMapCells;		///< Pathfinding map - contains iconic representation of the map
@@ -835,6 +895,10 @@ private:
 
 	Bool m_isMapReady;														///< True if all cells of map have been classified
 	Bool m_isTunneling;														///< True if path started in an obstacle
+	Bool m_restrictToCorridor;										///< True if ground cells outside of the zone block corridor are not searched
+	std::vector<PathfindCell*> m_corridorBorderCells;	///< Searched cells with neighbors outside of the corridor
+	UnsignedInt m_corridorSearchCount;						///< Number of corridor restricted searches since the last reset
+	UnsignedInt m_corridorLeftCount;							///< Number of these searches that had to leave the corridor
 
 	Int m_frameToShowObstacles;										///< Time to redraw obstacles.  For debug output.
 
@@ -856,9 +920,18 @@ private:
 
 	// Pathfind queue
 	ObjectID			m_queuedPathfindRequests[PATHFIND_QUEUE_LEN];
+	UnsignedByte	m_queuedPathfindPriorities[PATHFIND_QUEUE_LEN];	///< PathfindRequestPriority of each queued request
+	UnsignedInt		m_queuedPathfindFrames[PATHFIND_QUEUE_LEN];			///< Logic frame on which each request was queued
+	Int						m_queuedPathfindCounts[PATHFIND_PRIORITY_COUNT];
 	Int						m_queuePRHead;
 	Int						m_queuePRTail;
 	Int						m_cumulativeCellsAllocated;
+
+	PathfindQueueStats	m_queueStats;
+	UnsignedInt		m_queueLatencySum;
+
+	SharedGroupPathKey	m_sharedGroupPathKey;
+	Path					*m_sharedGroupPath;								///< Last group path found in this logic frame
 };
 
 
@@ -253,6 +253,16 @@ private:
 	void pauseGameMusic(Bool paused);
 	void pauseGameInput(Bool paused);
 
+public:
+	// TheSuperHackers @performance alanblack166 18/10/2026 The sleepy update heap stores the priority of each update module
+	// next to it, so that sifting compares the priorities without touching the update modules.
+	struct SleepyUpdateEntry
+	{
+		UnsignedInt priority;		///< copy of update->friend_getPriority()
+		UpdateModulePtr update;
+	};
+
+private:
 	void pushSleepyUpdate(UpdateModulePtr u);
 	UpdateModulePtr peekSleepyUpdate() const;
 	void popSleepyUpdate();
@@ -312,7 +322,7 @@ private:
 	// never modify it directly; please use the proper access methods.
 	// (for an excellent discussion of priority queues, please see:
 	// http://dogma.net/markn/articles/pq_stl/priority.htm)
-	std::vector<UpdateModulePtr> m_sleepyUpdates;
+	std::vector<SleepyUpdateEntry> m_sleepyUpdates;
 	
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	// this is a plain old list, not a pq.
@@ -57,6 +57,7 @@
 #include "Common/ObjectStatusTypes.h"
 #include "Common/KindOf.h"
 #include "Common/Snapshot.h"
+#include "Common/XferCRC.h"
 #include "Common/Geometry.h"
 #include "GameClient/Display.h"	// for ShroudLevel
 
@@ -194,6 +195,7 @@ private:
 	PartitionCell							*m_cell;									///< the cell being touched
 	PartitionData							*m_module;								///< the module (and thus, Object) touching
 	CellAndObjectIntersection *m_prevCoi, *m_nextCoi;		///< if in use, next/prev in this cell. if not in use, next/prev free in this module.
+	Int												m_moduleIndex;						///< if in use, the slot of this COI in the cell's module array.
 
 public:
 
@@ -237,6 +239,8 @@ public:
 	// only for use by PartitionCell.
 	void friend_addToCellList(CellAndObjectIntersection **pListHead);
 	void friend_removeFromCellList(CellAndObjectIntersection **pListHead);
+	inline Int friend_getModuleIndex() const { return m_moduleIndex; }
+	inline void friend_setModuleIndex(Int index) { m_moduleIndex = index; }
 };
 
 /**
@@ -294,6 +298,14 @@ struct ShroudStatusStoreRestore
 //=====================================
 class PartitionCell : public Snapshot	// not MPO: allocated in an array
 {
+public:
+	struct ModuleSlot
+	{
+		PartitionData							*module;		///< null if the COI left the cell and the array has not been compacted yet
+		CellAndObjectIntersection *coi;
+	};
+	typedef std::vector<ModuleSlot> ModuleSlotVec;
+
 private:
 	CellAndObjectIntersection*		m_firstCoiInCell;	///< list of COIs in this cell (may be null).
 	ShroudLevel										m_shroudLevel[MAX_PLAYER_COUNT];	
@@ -304,9 +316,13 @@ private:
 	Int														m_threatValue[MAX_PLAYER_COUNT];
 	Int														m_cashValue[MAX_PLAYER_COUNT];
 	Short													m_coiCount;					///< number of COIs in this cell.
+	ModuleSlotVec									m_modules;					///< modules of the COIs in this cell, newest last (the reverse of the COI list)
+	Int														m_emptyModuleSlots;	///< number of null slots in m_modules
 	Short													m_cellX;						///< x-coord of this cell within the Partition Mgr coords (NOT in world coords)
 	Short													m_cellY;						///< y-coord of this cell within the Partition Mgr coords (NOT in world coords)
 
+	void compactModules();
+
 public:
 
 	// Note, we allocate these in arrays, thus we must have a default ctor (and NOT descend from MPO)
@@ -353,6 +369,11 @@ public:
 
 	inline CellAndObjectIntersection *getFirstCoiInCell() { return m_firstCoiInCell; }
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The modules touching this cell are also kept in one contiguous array,
+	// so that object queries do not need to follow the COI links through memory.
+	// A removed module leaves a null slot behind, so callers must skip those.
+	inline const ModuleSlotVec& getModulesInCell() const { return m_modules; }
+
 	#ifdef RTS_DEBUG
 	void validateCoiList();
 	#endif
@@ -394,6 +415,9 @@ private:
 	Int													m_coiInUseCount;					///< number of COIs that are actually in use
 	CellAndObjectIntersection		*m_coiArray;							///< The array of COIs 
 	Int													m_doneFlag;
+#ifdef FASTER_GCO
+	Int													m_positionSlot;						///< index of the object position in the position arrays of the PartitionManager, or -1
+#endif
 	DirtyStatus									m_dirtyStatus;
 	ObjectShroudStatus					m_shroudedness[MAX_PLAYER_COUNT];						
 	ObjectShroudStatus					m_shroudednessPrevious[MAX_PLAYER_COUNT];	///<previous frames value of m_shroudedness						
@@ -493,6 +517,7 @@ public:
 
 	void attachToObject( Object* object );
 	void detachFromObject( void );
+	void updatePosition( void );	///< called by the Object whenever its position changes
 	void attachToGhostObject(GhostObject* object);
 	void detachFromGhostObject(void);
 
@@ -544,6 +569,9 @@ public:
 	ObjectShroudStatus friend_getShroudednessPrevious(Int playerIndex) {return m_shroudednessPrevious[playerIndex];}
 	
 	void friend_removeAllTouchedCells() { removeAllTouchedCells(); }	///< this is only for use by PartitionManager
+#ifdef FASTER_GCO
+	void friend_invalidateGcoCacheOfTouchedCells();	///< this is only for use by PartitionManager
+#endif
 	void friend_updateCellsTouched()	{ updateCellsTouched(); } ///< this is only for use by PartitionManager
 	Int friend_getCoiInUseCount() { return m_coiInUseCount; } ///< this is only for use by PartitionManager
 	Bool friend_collidesWith(const PartitionData *that, CollideLocAndNormal *cinfo) const { return collidesWith(that, cinfo); }	///< this is only for use by PartitionContactList
@@ -552,6 +580,9 @@ public:
 	// (note, if we ever use other bits in this, smarten this up...)
 	Int friend_getDoneFlag() { return m_doneFlag; }
 	void friend_setDoneFlag(Int i) { m_doneFlag = i; }
+#ifdef FASTER_GCO
+	Int friend_getPositionSlot() const { return m_positionSlot; }
+#endif
 
 	inline Bool isInListDirtyModules(PartitionData* const* pListHead) const
 	{
@@ -1218,9 +1249,64 @@ private:
 
 	std::queue<SightingInfo *> m_pendingUndoShroudReveals;	///< Anything can queue up an Undo to happen later. This is a queue, because "later" is a constant
 
+	enum { CELLS_PER_CRC_SEGMENT = 64 };	///< cells whose CRC data is cached together, see markCellCRCDirty
+	XferCRCSegmentCache			m_cellCRCCache;
+
 #ifdef FASTER_GCO
 	Int							m_maxGcoRadius;
 	RadiusVec				m_radiusVec;
+
+	enum { GCO_CACHE_MAX_RADIUS = 16 };	///< queries reaching farther than this many cells are not cached
+	enum { GCO_CACHE_BLOCK_SHIFT = 3 };	///< changes of the cell contents are tracked per block of 8x8 cells
+
+	/// the objects in the cells around one cell, in the order getClosestObjects visits them
+	struct GcoCellCache
+	{
+		GcoCellCache() : version(0), changeStamp(0), builtRadius(-1) {}
+
+		UnsignedInt									version;			///< valid only while equal to m_gcoCacheVersion
+		UnsignedInt									changeStamp;	///< m_gcoChangeStamp when the candidates were last gathered
+		Int													builtRadius;	///< radius up to which the candidates are gathered
+		std::vector<PartitionData*>	candidates;
+		std::vector<Object*>				candidateObjects;	///< getObject() of each candidate, so queries need not touch the PartitionData
+		std::vector<Int>						candidatePositionSlots;	///< position slot of each candidate, see m_objectPositions
+		std::vector<Int>						radiusEnds;		///< end index into candidates for each radius
+	};
+
+	std::vector<GcoCellCache>	m_gcoCellCaches;	///< one per cell
+	GcoCellCache						m_gcoScratchCache;	///< used for queries that are not cached
+	UnsignedInt							m_gcoCacheVersion;	///< bumped every frame
+	UnsignedInt							m_gcoChangeStamp;		///< bumped whenever any cell contents change
+	std::vector<UnsignedInt>	m_gcoBlockChangeStamps;	///< m_gcoChangeStamp of the last change in each block of cells
+	Int											m_gcoBlockCountX;
+	UnsignedInt							m_gcoCacheLookups;
+	UnsignedInt							m_gcoCacheHits;
+	UnsignedInt							m_gcoCacheLookupsLastFrame;
+	UnsignedInt							m_gcoCacheHitsLastFrame;
+	UnsignedInt							m_gcoCacheLookupsTotal;
+	UnsignedInt							m_gcoCacheHitsTotal;
+
+	/// scratch arrays for the batched center distance checks of getClosestObjects
+	struct GcoDistanceBatch
+	{
+		std::vector<Real>					x;
+		std::vector<Real>					y;
+		std::vector<Real>					z;
+		std::vector<Real>					distSqr;
+		std::vector<UnsignedByte>	inRange;
+	};
+	GcoDistanceBatch				m_gcoDistanceBatch;
+
+	/// the positions of all registered objects, one array per axis, so that the batched distance
+	/// checks read them from a few contiguous arrays instead of from each Object.
+	struct ObjectPositions
+	{
+		std::vector<Real>					x;
+		std::vector<Real>					y;
+		std::vector<Real>					z;
+		std::vector<Int>					freeSlots;
+	};
+	ObjectPositions					m_objectPositions;
 #endif
 
 protected:
@@ -1242,6 +1328,8 @@ protected:
 
 	void shutdown( void );
 
+	static void crcCellSegment( Xfer *xfer, Int segment, void *userData );
+
 	/// used to validate the positions for findPositionAround family of methods
 	Bool tryPosition( const Coord3D *center, Real dist, Real angle,
 										const FindPositionOptions *options, Coord3D *result );
@@ -1258,6 +1346,9 @@ protected:
 #ifdef FASTER_GCO
 	Int calcMinRadius(const ICoord2D& cur);
 	void calcRadiusVec();
+	void gatherGcoCandidates(GcoCellCache& cache, Int cellCenterX, Int cellCenterY, Int radius, Int iterFlag);
+	Bool isGcoCacheChanged(const GcoCellCache& cache, Int cellCenterX, Int cellCenterY) const;
+	void calcGcoDistanceBatch(const Coord3D *center, Bool is3D, const Int *positionSlots, Int count, Real maxDistSqr);
 #endif
 
 	// These are all friend functions now. They will continue to function as before, but can be passed into 
@@ -1293,6 +1384,8 @@ public:
 
 	inline Bool getUpdatedSinceLastReset( void ) const { return m_updatedSinceLastReset; }
 
+	static Int benchmarkDistances();	///< compares the batched and the scalar distance checks, returns 0 if they agree
+
 	void registerObject( Object *object );				///< add thing to system
 	void unRegisterObject( Object *object );			///< remove thing from system
 	void registerGhostObject( GhostObject* object);	///<recreate partition data needed to hold object (only used to restore after PM reset).
@@ -1310,6 +1403,9 @@ public:
 	PartitionCell *getCellAt(Int x, Int y);
 	const PartitionCell *getCellAt(Int x, Int y) const;
 
+	/// TheSuperHackers @performance alanblack166 18/10/2026 Must be called whenever the CRC data of the cell changes, which is its shroud.
+	void markCellCRCDirty(const PartitionCell *cell);
+
 	/// A convenience funtion to reveal shroud at some location 
 	// Queueing does not give you control of the timestamp to enforce the queue.  I own the delay, you don't.
 	void doShroudReveal( Real centerX, Real centerY, Real radius, PlayerMaskType playerMask);
@@ -1372,7 +1468,26 @@ public:
 #endif
 
 #ifdef DUMP_PERF_STATS
-	void getPMStats(double& gcoTimeThisFrameTotal, double& gcoTimeThisFrameAvg);
+	void getPMStats(double& gcoTimeThisFrameTotal, double& gcoTimeThisFrameAvg, double& gcoCacheHitRate);
+#endif
+
+#ifdef FASTER_GCO
+	/// these are only for use by PartitionData.
+	Int friend_allocPositionSlot();
+	void friend_freePositionSlot(Int slot);
+	void friend_setObjectPosition(Int slot, const Coord3D *pos)
+	{
+		m_objectPositions.x[slot] = pos->x;
+		m_objectPositions.y[slot] = pos->y;
+		m_objectPositions.z[slot] = pos->z;
+	}
+
+	/// called by PartitionCell whenever the objects in a cell change
+	void friend_invalidateGcoCache(Int cellX, Int cellY)
+	{
+		if (!m_gcoBlockChangeStamps.empty())
+			m_gcoBlockChangeStamps[(cellY >> GCO_CACHE_BLOCK_SHIFT) * m_gcoBlockCountX + (cellX >> GCO_CACHE_BLOCK_SHIFT)] = ++m_gcoChangeStamp;
+	}
 #endif
 
 	SimpleObjectIterator *iterateObjectsInRange(
@@ -1523,6 +1638,12 @@ inline const PartitionCell *PartitionManager::getCellAt(Int x, Int y) const
 	return (x < 0 || y < 0 || x >= m_cellCountX || y >= m_cellCountY) ? NULL : &m_cells[y * m_cellCountX + x];
 }
 
+//-----------------------------------------------------------------------------
+inline void PartitionManager::markCellCRCDirty(const PartitionCell *cell)
+{
+	m_cellCRCCache.markDirty((Int)(cell - m_cells) / CELLS_PER_CRC_SEGMENT);
+}
+
 //-----------------------------------------------------------------------------
 
 #ifdef FASTER_GCO
@@ -48,6 +48,7 @@ class Object;
 class ThingTemplate;
 class Player;
 class PolygonTrigger;
+class TeamPrototype;
 class ObjectTypes;
 
 #ifdef RTS_PROFILE
@@ -87,12 +88,14 @@ struct TCounter
 	Int value;
 	AsciiString name;
 	Bool isCountdownTimer;
+	UnsignedInt changeSerial; ///< Serial of the last change, see ScriptEngine::m_conditionChangeSerial
 };
 
 struct TFlag
 {
 	Bool value;
 	AsciiString name;
+	UnsignedInt changeSerial; ///< Serial of the last change, see ScriptEngine::m_conditionChangeSerial
 };
 
 typedef std::list<AsciiString> ListAsciiString;
@@ -226,6 +229,7 @@ public:
 	virtual void init( void );		///< Init
 	virtual void reset( void );		///< Reset
 	virtual void update( void );	///< Update
+	void updateBenchmark( void );	///< Update, and time it for -benchmarkScripts
 
 	void appendSequentialScript(const SequentialScript *scriptToSequence);
 	void removeSequentialScript(SequentialScript *scriptToRemove);
@@ -250,6 +254,7 @@ public:
 	virtual void runScript(const AsciiString& scriptName, Team *pThisTeam=NULL); ///<  Runs a script.
 	virtual void runObjectScript(const AsciiString& scriptName, Object *pThisObject=NULL); ///<  Runs a script attached to this object.
 	virtual Team *getTeamNamed(const AsciiString& teamName); ///<  Gets the named team.  May be null.
+	virtual Team *getTeamNamed(Parameter *pTeamParm); ///<  Gets the team named by the parameter, through its binding.  May be null.
 	virtual Player *getSkirmishEnemyPlayer(void); ///< Gets the ai's enemy Human player. May be null.
 	virtual Player *getCurrentPlayer(void); ///<  Gets the player that owns the current script.  May be null.
 	virtual Player *getPlayerFromAsciiString(const AsciiString& skirmishPlayerString);
@@ -266,23 +271,28 @@ public:
 	// NOTE NOTE NOTE: do not store of the return value of this call (getObjectTypeList) beyond the life of the 
 	// function it will be used in, as it can be deleted from under you if maintenance is performed on the object.
 	virtual ObjectTypes *getObjectTypes(const AsciiString& objectTypeList);
+	virtual ObjectTypes *getObjectTypes(Parameter *pTypeParm); ///< Gets the object type list named by the parameter, through its binding. May be null.
 	virtual void doObjectTypeListMaintenance(const AsciiString& objectTypeList, const AsciiString& objectType, Bool addObject);
 
 	/// Return the trigger area with the given name
 	virtual PolygonTrigger *getQualifiedTriggerAreaByName( AsciiString name );
+	virtual PolygonTrigger *getQualifiedTriggerAreaByName( Parameter *pTriggerParm );
 
 	// For other systems to evaluate Conditions, execute Actions, etc.
 
 	///< if pThisTeam is specified, then scripts in here can use <This Team> to mean the team this script is attached to.
 	virtual Bool evaluateConditions( Script *pScript, Team *pThisTeam = NULL, Player *pPlayer=NULL );	
-	virtual void friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam = NULL);	///< Use this at yer peril.
+	virtual void friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam = NULL, const Script *pScript = NULL);	///< Use this at yer peril.
 
 	virtual Object *getUnitNamed(const AsciiString& unitName); ///< Gets the named unit. May be null.
+	virtual Object *getUnitNamed(Parameter *pUnitParm); ///< Gets the unit named by the parameter, through its binding. May be null.
 	virtual Bool didUnitExist(const AsciiString& unitName);
+	virtual Bool didUnitExist(Parameter *pUnitParm);
 	virtual void addObjectToCache( Object* pNewObject );
 	virtual void removeObjectFromCache( Object* pDeadObject );
 	virtual void transferObjectName( const AsciiString& unitName, Object *pNewObject );
 	virtual void notifyOfObjectDestruction( Object *pDeadObject );
+	virtual void notifyOfObjectDeathChange( Object *pObject ); ///< The object became effectively dead, or alive again
 	virtual void notifyOfCompletedVideo( const AsciiString& completedVideo );	///< Notify the script engine that a video has completed
 	virtual void notifyOfTriggeredSpecialPower( Int playerIndex, const AsciiString& completedPower, ObjectID sourceObj );
 	virtual void notifyOfMidwaySpecialPower		( Int playerIndex, const AsciiString& completedPower, ObjectID sourceObj );
@@ -386,7 +396,10 @@ protected:
 	Bool evaluateFlag( Condition *pCondition );
 	Bool evaluateTimer( Condition *pCondition );
 	Bool evaluateCondition( Condition *pCondition );
+	void recordConditionDependencies( Condition *pCondition );
+	Bool isScriptSleeping( Script *pScript ) const;
 	void executeActions( ScriptAction *pActionHead );
+	void executeScriptActions( Script *pScript, ScriptAction *pActionHead );
 
 	void setPriorityThing( ScriptAction *pAction );
 	void setPriorityKind( ScriptAction *pAction );
@@ -395,11 +408,38 @@ protected:
 	// For Object types maintenance.
 	void removeObjectTypes(ObjectTypes *typesToRemove);
 
+	// For the named object cache. Entries of m_namedObjects only change through these, so the maps stay in sync.
+	Int findNamedObject(const AsciiString& unitName); ///< Position of the first entry with the name, or -1
+	Int findNamedObject(NameKeyType nameKey); ///< Position of the first entry with the name key, or -1
+	Int findNamedObject(const Object *obj); ///< Position of the first entry with the object, or -1
+	void addNamedObject(const AsciiString& unitName, Object *obj);
+	void setNamedObjectName(Int index, const AsciiString& unitName);
+	void setNamedObjectObject(Int index, Object *obj);
+	void clearNamedObjects();
+
 	void particleEditorUpdate( void );
 	void updateFades( void );
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The parameters of the conditions are bound to the name keys of the units and
+	// teams and to the trigger areas they name, once per map, so the conditions do not look the names up again
+	// every frame. Units and teams are still found through their name keys, so renamed units are found as before.
+	void bindConditionParameters(Script *pScript);
+	void bindParameter(Parameter *pParm);
+	NameKeyType getBoundNameKey(Parameter *pParm); ///< NAMEKEY_INVALID for the names that need the string lookup
+	Team *getTeamFromPrototype(TeamPrototype *theTeamProto, const AsciiString& teamName);
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 A script whose conditions were false, and that has no false actions, sleeps until
+	// something its conditions read changes: a counter, a timer, a flag, a UI interaction or a named object. Until then
+	// its conditions are known to still be false, so executeScript skips them. The frames to evaluate at advance as
+	// before, so the scripts fire on the same frames. Conditions that read any other state keep being evaluated.
+	void noteCounterChanged(Int counterNdx) { m_counters[counterNdx].changeSerial = ++m_conditionChangeSerial; }
+	void noteFlagChanged(Int flagNdx) { m_flags[flagNdx].changeSerial = ++m_conditionChangeSerial; }
+	void noteNamedObjectsChanged() { m_namedObjectsChangeSerial = ++m_conditionChangeSerial; }
+	void noteUIInteractionsChanged() { m_uiInteractionsChangeSerial = ++m_conditionChangeSerial; }
+	void wakeAllScripts() { m_conditionWakeSerial = ++m_conditionChangeSerial; }
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -417,6 +457,29 @@ protected:
 
 
 protected:
+	// TheSuperHackers @performance alanblack166 18/10/2026 The named objects are found through hash maps by name key and by object,
+	// instead of comparing the names one by one. m_namedObjects keeps its order for the xfer.
+	struct NamedObjectIndex
+	{
+		Int first;	///< Position of the first entry with the key in m_namedObjects
+		Int count;	///< Number of entries with the key, names on maps are not always unique
+	};
+
+	// use special class for hashing, since std::hash won't compile for arbitrary ptrs
+	struct hashConstObjectPtr
+	{
+		size_t operator()(const Object *obj) const
+		{
+			std::hash<UnsignedInt> hasher;
+			return hasher((UnsignedInt)(size_t)obj);
+		}
+	};
+
+	typedef std::hash_map< NameKeyType, NamedObjectIndex, rts::hash<NameKeyType>, rts::equal_to<NameKeyType> > NamedObjectsByName;
+	typedef std::hash_map< const Object *, NamedObjectIndex, hashConstObjectPtr, std::equal_to<const Object *> > NamedObjectsByObject;
+
+	static void addToNamedObjectIndex(NamedObjectIndex& entry, Int index);
+
 	ActionTemplate		m_actionTemplates[ScriptAction::NUM_ITEMS];
 	ConditionTemplate	m_conditionTemplates[Condition::NUM_ITEMS];
 	TCounter					m_counters[MAX_COUNTERS];
@@ -432,7 +495,20 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	NamedObjectsByName	m_namedObjectsByName;		///< Entries of m_namedObjects by the name key of their name
+	NamedObjectsByObject	m_namedObjectsByObject;	///< Entries of m_namedObjects by their object, if they have one
+	UnsignedInt				m_parameterGeneration;	///< Parameters bound with another generation are bound again
+	UnsignedInt				m_conditionChangeSerial;	///< Counts the changes of the state that sleeping scripts wait on
+	UnsignedInt				m_conditionWakeSerial;	///< Scripts that went to sleep up to this serial are awake
+	UnsignedInt				m_namedObjectsChangeSerial;
+	UnsignedInt				m_uiInteractionsChangeSerial;
+	std::vector<const UnsignedInt *> *m_conditionDependencies;	///< Where evaluateCondition records what the conditions read, if anywhere
+	Bool							m_conditionsTrackable;	///< FALSE once a recorded condition read state that is not tracked
 	Bool							m_firstUpdate;			
+	UnsignedInt				m_benchmarkFrames;		///< Frames timed by updateBenchmark so far
+	Int64							m_benchmarkTotalTicks;
+	Int64							m_benchmarkMinTicks;
+	Int64							m_benchmarkMaxTicks;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
 	AsciiString				m_currentTrackName;
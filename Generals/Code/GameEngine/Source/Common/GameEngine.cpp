@@ -67,6 +67,9 @@
 #include "Common/UserPreferences.h"
 #include "Common/Xfer.h"
 #include "Common/XferCRC.h"
+#include "Common/INICache.h"
+#include "Common/INIPrefetcher.h"
+#include "Common/StartupTimeline.h"
 #include "Common/GameLOD.h"
 #include "Common/Registry.h"
 
@@ -221,6 +224,20 @@ GameEngine::~GameEngine()
 	delete TheNameKeyGenerator;
 	TheNameKeyGenerator = NULL;
 
+	delete TheINIPrefetcher;
+	TheINIPrefetcher = NULL;
+
+	delete TheStartupTimeline;
+	TheStartupTimeline = NULL;
+
+	if (TheINICache)
+	{
+		// store the INI files that were loaded after the startup as well.
+		TheINICache->save();
+		delete TheINICache;
+		TheINICache = NULL;
+	}
+
 	delete TheFileSystem;
 	TheFileSystem = NULL;
 
@@ -265,6 +282,9 @@ void GameEngine::init()
 			DEBUG_LOG(("================================================================================"));
 		}
 		
+		// TheSuperHackers @performance alanblack166 18/10/2026 Record where the startup time goes, reported at the end of init.
+		TheStartupTimeline = NEW StartupTimeline;
+
 		m_maxFPS = DEFAULT_MAX_FPS;
 
 		TheSubsystemList = MSGNEW("GameEngineSubsystem") SubsystemInterfaceList;
@@ -281,18 +301,36 @@ void GameEngine::init()
 		TheNameKeyGenerator = MSGNEW("GameEngineSubsystem") NameKeyGenerator;
 		TheNameKeyGenerator->init();
 
+		TheStartupTimeline->mark("TheNameKeyGenerator");
+
 		// not part of the subsystem list, because it should normally never be reset!
 		TheCommandList = MSGNEW("GameEngineSubsystem") CommandList;
 		TheCommandList->init();
 
+		TheStartupTimeline->mark("TheCommandList");
+
 		XferCRC xferCRC;
 		xferCRC.open("lightCRC");
 
 		initSubsystem(TheLocalFileSystem, "TheLocalFileSystem", createLocalFileSystem(), NULL);
+		TheStartupTimeline->mark("TheLocalFileSystem");
 		initSubsystem(TheArchiveFileSystem, "TheArchiveFileSystem", createArchiveFileSystem(), NULL); // this MUST come after TheLocalFileSystem creation
+
+		TheStartupTimeline->mark("TheArchiveFileSystem");
 		
+		if (TheGlobalData->m_useINICache)
+		{
+			// TheSuperHackers @performance alanblack166 18/10/2026 The INI cache must exist before the first INI file is loaded.
+			AsciiString cacheFilename = TheGlobalData->getPath_UserData();
+			cacheFilename.concat("INICache.dat");
+			TheINICache = NEW INICache;
+			TheINICache->load(cacheFilename);
+		}
+
 		DEBUG_ASSERTCRASH(TheWritableGlobalData,("TheWritableGlobalData expected to be created"));
 		initSubsystem(TheWritableGlobalData, "TheWritableGlobalData", TheWritableGlobalData, &xferCRC, "Data\\INI\\Default\\GameData.ini", "Data\\INI\\GameData.ini");
+
+		TheStartupTimeline->mark("TheWritableGlobalData");
 		
 		// TheSuperHackers @bugfix helmutbuhler 14/04/2025
 		// Pump messages during startup to ensure that the application window is correctly
@@ -321,6 +359,17 @@ void GameEngine::init()
 			updateTGAtoDDS();
 		}
 
+		if (TheGlobalData->m_useINIPrefetch)
+		{
+			// TheSuperHackers @performance alanblack166 18/10/2026 Split the INI files into lines on worker threads, while the
+			// subsystems below parse them in their usual order. This must come after loading the mods,
+			// so that the prefetched files are the ones that the subsystems would read.
+			TheINIPrefetcher = NEW INIPrefetcher(INI::tokenizeLines);
+			TheINIPrefetcher->addDirectory("Data\\INI");
+			TheINIPrefetcher->finishQueue();
+			TheStartupTimeline->mark("INI prefetch");
+		}
+
 	#if defined(PERF_TIMERS) || defined(DUMP_PERF_STATS)
 		DEBUG_LOG(("Calculating CPU frequency for performance timers."));
 		InitPrecisionTimer();
@@ -333,17 +382,22 @@ void GameEngine::init()
 		ini.load( AsciiString( "Data\\INI\\Default\\Water.ini" ), INI_LOAD_OVERWRITE, &xferCRC );
 		ini.load( AsciiString( "Data\\INI\\Water.ini" ), INI_LOAD_OVERWRITE, &xferCRC );
 
+		TheStartupTimeline->mark("Water INI");
+
 #ifdef DEBUG_CRC
 		initSubsystem(TheDeepCRCSanityCheck, "TheDeepCRCSanityCheck", MSGNEW("GameEngineSubystem") DeepCRCSanityCheck, NULL, NULL, NULL, NULL);
 #endif // DEBUG_CRC
 		initSubsystem(TheGameText, "TheGameText", CreateGameTextInterface(), NULL);
+		TheStartupTimeline->mark("TheGameText");
 		initSubsystem(TheScienceStore,"TheScienceStore", MSGNEW("GameEngineSubsystem") ScienceStore(), &xferCRC, "Data\\INI\\Default\\Science.ini", "Data\\INI\\Science.ini");
 		initSubsystem(TheMultiplayerSettings,"TheMultiplayerSettings", MSGNEW("GameEngineSubsystem") MultiplayerSettings(), &xferCRC, "Data\\INI\\Default\\Multiplayer.ini", "Data\\INI\\Multiplayer.ini");
 		initSubsystem(TheTerrainTypes,"TheTerrainTypes", MSGNEW("GameEngineSubsystem") TerrainTypeCollection(), &xferCRC, "Data\\INI\\Default\\Terrain.ini", "Data\\INI\\Terrain.ini");
 		initSubsystem(TheTerrainRoads,"TheTerrainRoads", MSGNEW("GameEngineSubsystem") TerrainRoadCollection(), &xferCRC, "Data\\INI\\Default\\Roads.ini", "Data\\INI\\Roads.ini");
 		initSubsystem(TheGlobalLanguageData,"TheGlobalLanguageData",MSGNEW("GameEngineSubsystem") GlobalLanguage, NULL); // must be before the game text
 		initSubsystem(TheCDManager,"TheCDManager", CreateCDManager(), NULL);
+		TheStartupTimeline->mark("TheCDManager");
 		initSubsystem(TheAudio,"TheAudio", TheGlobalData->m_headless ? NEW AudioManagerDummy : createAudioManager(), NULL);
+		TheStartupTimeline->mark("TheAudio");
 		if (!TheAudio->isMusicAlreadyLoaded())
 			setQuitting(TRUE);
 		initSubsystem(TheFunctionLexicon,"TheFunctionLexicon", createFunctionLexicon(), NULL);
@@ -354,6 +408,7 @@ void GameEngine::init()
 		initSubsystem(TheRankInfoStore,"TheRankInfoStore", MSGNEW("GameEngineSubsystem") RankInfoStore(), &xferCRC, NULL, "Data\\INI\\Rank.ini");
 		initSubsystem(ThePlayerTemplateStore,"ThePlayerTemplateStore", MSGNEW("GameEngineSubsystem") PlayerTemplateStore(), &xferCRC, "Data\\INI\\Default\\PlayerTemplate.ini", "Data\\INI\\PlayerTemplate.ini");
 		initSubsystem(TheParticleSystemManager,"TheParticleSystemManager", createParticleSystemManager(), NULL);
+		TheStartupTimeline->mark("TheParticleSystemManager");
 		initSubsystem(TheFXListStore,"TheFXListStore", MSGNEW("GameEngineSubsystem") FXListStore(), &xferCRC, "Data\\INI\\Default\\FXList.ini", "Data\\INI\\FXList.ini");
 		initSubsystem(TheWeaponStore,"TheWeaponStore", MSGNEW("GameEngineSubsystem") WeaponStore(), &xferCRC, NULL, "Data\\INI\\Weapon.ini");
 		initSubsystem(TheObjectCreationListStore,"TheObjectCreationListStore", MSGNEW("GameEngineSubsystem") ObjectCreationListStore(), &xferCRC, "Data\\INI\\Default\\ObjectCreationList.ini", "Data\\INI\\ObjectCreationList.ini");
@@ -362,9 +417,12 @@ void GameEngine::init()
 		initSubsystem(TheDamageFXStore,"TheDamageFXStore", MSGNEW("GameEngineSubsystem") DamageFXStore(), &xferCRC, NULL, "Data\\INI\\DamageFX.ini");
 		initSubsystem(TheArmorStore,"TheArmorStore", MSGNEW("GameEngineSubsystem") ArmorStore(), &xferCRC, NULL, "Data\\INI\\Armor.ini");
 		initSubsystem(TheBuildAssistant,"TheBuildAssistant", MSGNEW("GameEngineSubsystem") BuildAssistant, NULL);
+		TheStartupTimeline->mark("TheBuildAssistant");
 		initSubsystem(TheThingFactory,"TheThingFactory", createThingFactory(), &xferCRC, "Data\\INI\\Default\\Object.ini", NULL, "Data\\INI\\Object");
+		TheStartupTimeline->mark("TheThingFactory");
 		initSubsystem(TheUpgradeCenter,"TheUpgradeCenter", MSGNEW("GameEngineSubsystem") UpgradeCenter, &xferCRC, "Data\\INI\\Default\\Upgrade.ini", "Data\\INI\\Upgrade.ini");
 		initSubsystem(TheGameClient,"TheGameClient", createGameClient(), NULL);
+		TheStartupTimeline->mark("TheGameClient");
 		initSubsystem(TheAI,"TheAI", MSGNEW("GameEngineSubsystem") AI(), &xferCRC,  "Data\\INI\\Default\\AIData.ini", "Data\\INI\\AIData.ini");
 		initSubsystem(TheGameLogic,"TheGameLogic", createGameLogic(), NULL);
 		initSubsystem(TheTeamFactory,"TheTeamFactory", MSGNEW("GameEngineSubsystem") TeamFactory(), NULL);
@@ -374,6 +432,8 @@ void GameEngine::init()
 		initSubsystem(TheRadar,"TheRadar", TheGlobalData->m_headless ? NEW RadarDummy : createRadar(), NULL);
 		initSubsystem(TheVictoryConditions,"TheVictoryConditions", createVictoryConditions(), NULL);
 
+		TheStartupTimeline->mark("TheVictoryConditions");
+
 		AsciiString fname;
 		fname.format("Data\\%s\\CommandMap.ini", GetRegistryLanguage().str());
 		initSubsystem(TheMetaMap,"TheMetaMap", MSGNEW("GameEngineSubsystem") MetaMap(), NULL, fname.str(), "Data\\INI\\CommandMap.ini");
@@ -392,10 +452,25 @@ void GameEngine::init()
 		// Create the interface for sending game results
 		initSubsystem(TheGameResultsQueue,"TheGameResultsQueue", GameResultsInterface::createNewGameResultsInterface(), NULL, NULL, NULL, NULL);
 
+		TheStartupTimeline->mark("TheGameResultsQueue");
+
 		xferCRC.close();
 		TheWritableGlobalData->m_iniCRC = xferCRC.getCRC();
 		DEBUG_LOG(("INI CRC is 0x%8.8X", TheGlobalData->m_iniCRC));
 
+		if (TheINICache)
+		{
+			DEBUG_LOG(("INI cache hits %u, misses %u", TheINICache->getHits(), TheINICache->getMisses()));
+			TheINICache->save();
+		}
+
+		if (TheINIPrefetcher)
+		{
+			TheINIPrefetcher->addCounters(TheStartupTimeline);
+			delete TheINIPrefetcher;
+			TheINIPrefetcher = NULL;
+		}
+
 		TheSubsystemList->postProcessLoadAll();
 
 		setFramesPerSecondLimit(TheGlobalData->m_framesPerSecondLimit);
@@ -421,6 +496,8 @@ void GameEngine::init()
 		TheMapCache = MSGNEW("GameEngineSubsystem") MapCache;
 		TheMapCache->updateCache();
 
+		TheStartupTimeline->mark("TheMapCache->updateCache");
+
 		if (TheGlobalData->m_buildMapCache)
 		{
 			// just quit, since the map cache has already updated
@@ -502,6 +579,12 @@ void GameEngine::init()
 	resetSubsystems();
 
 	HideControlBar();
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Report where the startup time went.
+	TheStartupTimeline->mark("Masks and subsystem reset");
+	TheStartupTimeline->report(TheGlobalData->m_startupTimelineFile);
+	delete TheStartupTimeline;
+	TheStartupTimeline = NULL;
 }  // end init
 
 /** -----------------------------------------------------------------------------------------------
@@ -55,6 +55,8 @@
 
 #include "GameNetwork/FirewallHelper.h"
 
+#include "Compression.h"
+
 // PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
 GlobalData* TheWritableGlobalData = NULL;				///< The global data singleton
 
@@ -955,6 +957,21 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplaysPerJob = 1;
+	m_simulateReplaySummary.clear();
+	m_simulateReplayCheckpointInterval = 0;
+	m_simulateReplayProfile.clear();
+	m_benchmarkArchives = FALSE;
+	m_benchmarkCRC = FALSE;
+	m_benchmarkParticles = FALSE;
+	m_benchmarkPartitionDistances = FALSE;
+	m_benchmarkScriptFrames = 0;
+	m_useINICache = FALSE;
+	m_useINIPrefetch = FALSE;
+	m_startupTimelineFile.clear();
+	m_saveGameCompression = COMPRESSION_NONE;
+	m_poolStatsFile.clear();
+	m_scriptProfileFile.clear();
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
@@ -34,6 +34,8 @@
 
 #include "Common/INI.h"
 #include "Common/INIException.h"
+#include "Common/INICache.h"
+#include "Common/INIPrefetcher.h"
 
 #include "Common/DamageFX.h"
 #include "Common/file.h"
@@ -185,6 +187,9 @@ INI::INI( void )
 	m_blockEndToken			= "END";
 	m_endOfFile					= FALSE;
 	m_buffer[0]					= 0;
+	m_cachedLine				= NULL;
+	m_cachedLinesEnd		= NULL;
+	m_recordLines				= FALSE;
 #ifdef DEBUG_CRASHING
 	m_curBlockStart[0]	= 0;
 #endif
@@ -254,7 +259,7 @@ void INI::loadDirectory( AsciiString dirName, Bool subdirs, INILoadType loadType
 void INI::prepFile( AsciiString filename, INILoadType loadType )
 {
 	// if we have a file open already -- we can't do another one
-	if( m_file != NULL )
+	if( m_file != NULL || m_cachedLine != NULL )
 	{
 
 		DEBUG_CRASH(( "INI::load, cannot open file '%s', file already open", filename.str() ));
@@ -262,6 +267,16 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 
 	}  // end if
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The lines of a prefetched file are ready, so the file is not opened again.
+	if (TheINIPrefetcher != NULL && TheINIPrefetcher->takeLines(filename, m_prefetchedLines) && !m_prefetchedLines.empty())
+	{
+		m_filename = filename;
+		m_loadType = loadType;
+		m_cachedLine = &m_prefetchedLines[0];
+		m_cachedLinesEnd = m_cachedLine + m_prefetchedLines.size();
+		return;
+	}
+
 	// open the file
 	m_file = TheFileSystem->openFile(filename.str(), File::READ);
 	if( m_file == NULL )
@@ -279,6 +294,105 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 
 	// save our load time
 	m_loadType = loadType;
+
+	if (TheINICache != NULL)
+		prepCachedLines();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance alanblack166 18/10/2026 Looks up the lines of the opened file in the INI cache.
+	* When the file did not change, readLine replays the cached lines instead of cleaning up the text.
+	* Otherwise the lines are recorded, and stored in the cache once the file was loaded. */
+//-------------------------------------------------------------------------------------------------
+void INI::prepCachedLines( void )
+{
+	if (!INICache::getSource(m_filename, &m_source))
+		return;
+
+	const INICache::Entry *entry = TheINICache->find(m_filename, m_source);
+	if (entry != NULL && !entry->lines.empty())
+	{
+		m_cachedLine = &entry->lines[0];
+		m_cachedLinesEnd = m_cachedLine + entry->lines.size();
+	}
+	else
+	{
+		m_recordLines = TRUE;
+		m_recordedLines.clear();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Writes the next cached line into the line buffer exactly like readLine wrote it when it was
+	* recorded, including the terminator and the end of file state. */
+//-------------------------------------------------------------------------------------------------
+void INI::replayCachedLine( void )
+{
+	UnsignedShort length;
+	memcpy(&length, m_cachedLine, sizeof(length));
+	memcpy(m_buffer, m_cachedLine + sizeof(length), length);
+	if (length < sizeof(m_buffer))
+		m_buffer[length] = 0;
+
+	m_cachedLine += sizeof(length) + length;
+	m_lineNum++;
+	m_endOfFile = (m_cachedLine >= m_cachedLinesEnd);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance alanblack166 18/10/2026 Splits the text of an INI file into the lines that readLine produces
+	* for it, in the format of the INI cache. The characters must be cleaned up exactly like readLine
+	* does it. This runs on the INI prefetch threads, so it must not touch anything but its arguments. */
+//-------------------------------------------------------------------------------------------------
+void INI::tokenizeLines( const char *filename, const char *text, Int size, std::vector<char> &lines )
+{
+	char buffer[ INI_MAX_CHARS_PER_LINE ];
+	Int pos = 0;
+	Int lineNum = 0;
+	Bool endOfFile = FALSE;
+
+	lines.reserve(size + size / 8);
+	while( !endOfFile )
+	{
+		Bool isComment = FALSE;
+		Int i = 0;
+		Bool done = FALSE;
+		while( !done )
+		{
+			endOfFile = (pos == size);
+			if( endOfFile )
+			{
+				done = TRUE;
+				buffer[ i ] = '\0';
+			}
+			else
+			{
+				buffer[ i ] = text[ pos++ ];
+			}
+
+			if( buffer[ i ] == '\n' )
+				done = TRUE;
+
+			DEBUG_ASSERTCRASH(buffer[ i ] != '\t', ("tab characters are not allowed in INI files (%s). please check your editor settings. Line Number %d",filename, lineNum));
+
+			if( isspace( buffer[ i ] ) )
+				buffer[ i ] = ' ';
+
+			if( buffer[ i ] == ';' )
+				isComment = TRUE;
+
+			if( isComment == TRUE )
+				buffer[ i ] = '\0';
+
+			if( ++i == INI_MAX_CHARS_PER_LINE )
+				done = TRUE;
+		}
+
+		const UnsignedShort length = (UnsignedShort)i;
+		lines.insert(lines.end(), (const char *)&length, (const char *)&length + sizeof(length));
+		lines.insert(lines.end(), buffer, buffer + length);
+		++lineNum;
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -286,12 +400,21 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 void INI::unPrepFile()
 {
 	// close the file
-	m_file->close();
-	m_file = NULL;
+	if (m_file != NULL)
+	{
+		m_file->close();
+		m_file = NULL;
+	}
 	m_filename = "None";
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
 	m_endOfFile = FALSE;
+	m_cachedLine = NULL;
+	m_cachedLinesEnd = NULL;
+	m_recordLines = FALSE;
+	m_recordedLines.clear();
+	std::vector<char> noLines;
+	m_prefetchedLines.swap(noLines);
 	s_xfer = NULL;
 }
 
@@ -399,6 +522,9 @@ void INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 		throw;
 	}
 
+	if (m_recordLines)
+		TheINICache->store(m_filename, m_source, m_recordedLines);
+
 	unPrepFile();
 
 }  // end load
@@ -412,13 +538,17 @@ void INI::readLine( void )
 	Bool isComment = FALSE;
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_file, ("readLine(), file pointer is NULL") );
+	DEBUG_ASSERTCRASH( m_file || m_cachedLine, ("readLine(), file pointer is NULL") );
 
 	// if we've reached end of file we'll just keep returning empty string in our buffer
 	if( m_endOfFile )
 	{
 		m_buffer[ 0 ] = '\0';	
 	}
+	else if( m_cachedLine )
+	{
+		replayCachedLine();
+	}
 	else
 	{
 		// read up till the newline character or until out of space
@@ -470,6 +600,13 @@ void INI::readLine( void )
 
 		}  // end while
 
+		if( m_recordLines )
+		{
+			const UnsignedShort length = (UnsignedShort)i;
+			m_recordedLines.insert(m_recordedLines.end(), (const char *)&length, (const char *)&length + sizeof(length));
+			m_recordedLines.insert(m_recordedLines.end(), m_buffer, m_buffer + length);
+		}
+
 		// increase our line count
 		m_lineNum++;
 
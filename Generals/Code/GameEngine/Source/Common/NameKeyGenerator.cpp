@@ -30,6 +30,8 @@
 
 #include "PreRTS.h"	// This must go first in EVERY cpp file int the GameEngine
 
+#include "Common/CriticalSection.h"
+
 // Public Data ////////////////////////////////////////////////////////////////////////////////////
 NameKeyGenerator *TheNameKeyGenerator = NULL;  ///< name key gen. singleton
 
@@ -38,10 +40,14 @@ NameKeyGenerator::NameKeyGenerator()
 {
 
 	m_nextID = (UnsignedInt)NAMEKEY_INVALID;  // uninitialized system
+	m_addNameCriticalSection = NEW CriticalSection;
 
 	for (Int i = 0; i < SOCKET_COUNT; ++i)
 		m_sockets[i] = NULL;
 
+	for (Int i = 0; i < KEY_PAGE_COUNT; ++i)
+		m_keyPages[i] = NULL;
+
 }  // end NameKeyGenerator
 
 //------------------------------------------------------------------------------------------------- 
@@ -51,6 +57,8 @@ NameKeyGenerator::~NameKeyGenerator()
 	// free all system data
 	freeSockets();
 
+	delete m_addNameCriticalSection;
+
 }  // end ~NameKeyGenerator
 
 //------------------------------------------------------------------------------------------------- 
@@ -86,10 +94,16 @@ void NameKeyGenerator::freeSockets()
 		m_sockets[i] = NULL;
 	}
 
+	for (Int i = 0; i < KEY_PAGE_COUNT; ++i)
+	{
+		delete [] m_keyPages[i];
+		m_keyPages[i] = NULL;
+	}
+
 }  // end freeSockets
 
 /* ------------------------------------------------------------------------ */
-inline UnsignedInt calcHashForString(const char* p)
+UnsignedInt NameKeyGenerator::calcHashForString(const char* p)
 {
 	UnsignedInt result = 0; 
 	Byte *pp = (Byte*)p;
@@ -99,7 +113,7 @@ inline UnsignedInt calcHashForString(const char* p)
 }
 
 /* ------------------------------------------------------------------------ */
-inline UnsignedInt calcHashForLowercaseString(const char* p)
+UnsignedInt NameKeyGenerator::calcHashForLowercaseString(const char* p)
 {
 	UnsignedInt result = 0; 
 	Byte *pp = (Byte*)p;
@@ -109,13 +123,16 @@ inline UnsignedInt calcHashForLowercaseString(const char* p)
 }
 
 //------------------------------------------------------------------------------------------------- 
-AsciiString NameKeyGenerator::keyToName(NameKeyType key)
+const AsciiString& NameKeyGenerator::keyToName(NameKeyType key) const
 {
-	for (Int i = 0; i < SOCKET_COUNT; ++i)
+	const UnsignedInt id = (UnsignedInt)key;
+	if (id < (UnsignedInt)NAMEKEY_MAX)
 	{
-		for (Bucket *b = m_sockets[i]; b; b = b->m_nextInSocket)
+		KeyPage page = m_keyPages[id / KEY_PAGE_SIZE];
+		if (page)
 		{
-			if (key == b->m_key)
+			const Bucket *b = page[id % KEY_PAGE_SIZE];
+			if (b)
 				return b->m_nameString;
 		}
 	}
@@ -123,36 +140,67 @@ AsciiString NameKeyGenerator::keyToName(NameKeyType key)
 }
 
 //------------------------------------------------------------------------------------------------- 
-NameKeyType NameKeyGenerator::nameToKey(const char* nameString)
+Bucket* NameKeyGenerator::findBucket(const char* nameString, UnsignedInt socket, Bool ignoreCase) const
 {
-	Bucket *b;
-
-	UnsignedInt hash = calcHashForString(nameString) % SOCKET_COUNT;
-
-	// hmm, do we have it already?
-	for (b = m_sockets[hash]; b; b = b->m_nextInSocket)
+	for (Bucket *b = m_sockets[socket]; b; b = b->m_nextInSocket)
 	{
-		if (strcmp(nameString, b->m_nameString.str()) == 0)
-			return b->m_key; 
+		const Int cmp = ignoreCase ? _stricmp(nameString, b->m_nameString.str()) : strcmp(nameString, b->m_nameString.str());
+		if (cmp == 0)
+			return b;
 	}
+	return NULL;
+}
+
+//------------------------------------------------------------------------------------------------- 
+NameKeyType NameKeyGenerator::addName(const char* nameString, UnsignedInt socket, Bool ignoreCase)
+{
+	ScopedCriticalSection scopedCriticalSection(m_addNameCriticalSection);
+
+	// another thread may have added it while we waited for the lock.
+	Bucket *b = findBucket(nameString, socket, ignoreCase);
+	if (b)
+		return b->m_key;
+
+	DEBUG_ASSERTCRASH(m_nextID < (UnsignedInt)NAMEKEY_MAX, ("NameKeyGenerator ran out of keys"));
 
 	// nope, guess not. let's allocate it.
 	b = newInstance(Bucket);
 	b->m_key = (NameKeyType)m_nextID++;
 	b->m_nameString = nameString;
-	b->m_nextInSocket = m_sockets[hash];
-	m_sockets[hash] = b;
+	b->m_nextInSocket = m_sockets[socket];
 
-	NameKeyType result = b->m_key;
+	const UnsignedInt id = (UnsignedInt)b->m_key;
+	KeyPage page = m_keyPages[id / KEY_PAGE_SIZE];
+	if (page == NULL)
+	{
+		page = NEW Bucket * volatile [KEY_PAGE_SIZE];
+		for (Int i = 0; i < KEY_PAGE_SIZE; ++i)
+			page[i] = NULL;
+		m_keyPages[id / KEY_PAGE_SIZE] = page;
+	}
+	page[id % KEY_PAGE_SIZE] = b;
+
+	// the bucket is complete now, so lookups on other threads may find it from here on.
+	m_sockets[socket] = b;
 
 #if defined(RTS_DEBUG)
+	checkSocketDepth();
+#endif
+
+	return b->m_key;
+
+}  // end addName
+
+//------------------------------------------------------------------------------------------------- 
+void NameKeyGenerator::checkSocketDepth() const
+{
 	// reality-check to be sure our hasher isn't going bad.
 	const Int maxThresh = 3;
 	Int numOverThresh = 0;
 	for (Int i = 0; i < SOCKET_COUNT; ++i)
 	{
 		Int numInThisSocket = 0;
-		for (b = m_sockets[i]; b; b = b->m_nextInSocket)
+		for (const Bucket *b = m_sockets[i]; b; b = b->m_nextInSocket)
 			++numInThisSocket;
 
 		if (numInThisSocket > maxThresh)
@@ -164,57 +212,44 @@ NameKeyType NameKeyGenerator::nameToKey(const char* nameString)
 	{
 		DEBUG_CRASH(("hmm, might need to increase the number of bucket-sockets for NameKeyGenerator (numOverThresh %d = %f%%)",numOverThresh,(Real)numOverThresh/(Real)(SOCKET_COUNT/20)));
 	}
-#endif
-
-	return result;
 
-}  // end nameToKey
+}  // end checkSocketDepth
 
 //------------------------------------------------------------------------------------------------- 
-NameKeyType NameKeyGenerator::nameToLowercaseKey(const char* nameString)
+NameKeyType NameKeyGenerator::nameToKey(const char* nameString, UnsignedInt hash)
 {
-	Bucket *b;
+	DEBUG_ASSERTCRASH(hash == calcHashForString(nameString), ("NameKeyGenerator: wrong hash for %s", nameString));
 
-	UnsignedInt hash = calcHashForLowercaseString(nameString) % SOCKET_COUNT;
+	const UnsignedInt socket = hash % SOCKET_COUNT;
 
 	// hmm, do we have it already?
-	for (b = m_sockets[hash]; b; b = b->m_nextInSocket)
-	{
-		if (_stricmp(nameString, b->m_nameString.str()) == 0)
-			return b->m_key; 
-	}
+	Bucket *b = findBucket(nameString, socket, FALSE);
+	if (b)
+		return b->m_key;
 
-	// nope, guess not. let's allocate it.
-	b = newInstance(Bucket);
-	b->m_key = (NameKeyType)m_nextID++;
-	b->m_nameString = nameString;
-	b->m_nextInSocket = m_sockets[hash];
-	m_sockets[hash] = b;
+	return addName(nameString, socket, FALSE);
 
-	NameKeyType result = b->m_key;
+}  // end nameToKey
 
-#if defined(RTS_DEBUG)
-	// reality-check to be sure our hasher isn't going bad.
-	const Int maxThresh = 3;
-	Int numOverThresh = 0;
-	for (Int i = 0; i < SOCKET_COUNT; ++i)
-	{
-		Int numInThisSocket = 0;
-		for (b = m_sockets[i]; b; b = b->m_nextInSocket)
-			++numInThisSocket;
+//------------------------------------------------------------------------------------------------- 
+NameKeyType NameKeyGenerator::findNameKey(const char* nameString) const
+{
+	const Bucket *b = findBucket(nameString, calcHashForString(nameString) % SOCKET_COUNT, FALSE);
+	return b ? b->m_key : NAMEKEY_INVALID;
 
-		if (numInThisSocket > maxThresh)
-			++numOverThresh;
-	}
-	
-	// if more than a small percent of the sockets are getting deep, probably want to increase the socket count.
-	if (numOverThresh > SOCKET_COUNT/20)
-	{
-		DEBUG_CRASH(("hmm, might need to increase the number of bucket-sockets for NameKeyGenerator (numOverThresh %d = %f%%)",numOverThresh,(Real)numOverThresh/(Real)(SOCKET_COUNT/20)));
-	}
-#endif
+}  // end findNameKey
 
-	return result;
+//------------------------------------------------------------------------------------------------- 
+NameKeyType NameKeyGenerator::nameToLowercaseKey(const char* nameString)
+{
+	const UnsignedInt socket = calcHashForLowercaseString(nameString) % SOCKET_COUNT;
+
+	// hmm, do we have it already?
+	Bucket *b = findBucket(nameString, socket, TRUE);
+	if (b)
+		return b->m_key;
+
+	return addName(nameString, socket, TRUE);
 
 }  // end nameToLowercaseKey
 
@@ -234,7 +269,7 @@ NameKeyType StaticNameKey::key() const
 	{
 		DEBUG_ASSERTCRASH(TheNameKeyGenerator, ("no TheNameKeyGenerator yet"));
 		if (TheNameKeyGenerator)
-			m_key = TheNameKeyGenerator->nameToKey(m_name);
+			m_key = TheNameKeyGenerator->nameToKey(m_name, m_hash);
 	}
 	return m_key;
 }
@@ -272,8 +272,13 @@ void TeamFactory::removeTeamPrototypeFromList(TeamPrototype* team)
 // ------------------------------------------------------------------------
 TeamPrototype *TeamFactory::findTeamPrototype(const AsciiString& name)
 {
-	NameKeyType nk = NAMEKEY(name);
-	TeamPrototypeMap::iterator it = m_prototypes.find(nk);
+	return findTeamPrototype(NAMEKEY(name));
+}
+
+// ------------------------------------------------------------------------
+TeamPrototype *TeamFactory::findTeamPrototype(NameKeyType nameKey)
+{
+	TeamPrototypeMap::iterator it = m_prototypes.find(nameKey);
 	if (it != m_prototypes.end())
 		return it->second;
 
@@ -341,7 +346,7 @@ Team *TeamFactory::createInactiveTeam(const AsciiString& name)
 			if (tp->getTemplateInfo()->m_executeActions) {
 				const Script *script = TheScriptEngine->findScriptByName(tp->getTemplateInfo()->m_productionCondition);
 				if (script) {
-					TheScriptEngine->friend_executeAction(script->getAction());
+					TheScriptEngine->friend_executeAction(script->getAction(), NULL, script);
 				}
 			}
 			return t;
@@ -352,7 +357,7 @@ Team *TeamFactory::createInactiveTeam(const AsciiString& name)
 	if (tp->getTemplateInfo()->m_executeActions) {
 		const Script *script = TheScriptEngine->findScriptByName(tp->getTemplateInfo()->m_productionCondition);
 		if (script) {
-			TheScriptEngine->friend_executeAction(script->getAction());
+			TheScriptEngine->friend_executeAction(script->getAction(), NULL, script);
 		}
 	}
 	
@@ -2532,7 +2537,7 @@ void Team::updateGenericScripts(void)
 					if (script->isOneShot()) {
 						m_shouldAttemptGenericScript[i] = false;
 					}
-					TheScriptEngine->friend_executeAction(script->getAction(), this);
+					TheScriptEngine->friend_executeAction(script->getAction(), this, script);
 					AsciiString msg = "Generic script '";
 					msg.concat(script->getName());
 					msg.concat("' run on team ");
@@ -506,6 +506,7 @@ static PoolSizeRec sizes[] =
 	{ "SequentialScript", 32, 32 },
 	{ "Win32LocalFile", 1024, 256 },
 	{ "RAMFile", 32, 32 },
+	{ "StdMappedFile", 32, 32 },
 	{ "BattlePlanBonuses", 32, 32 },
 	{ "KindOfPercentProductionChange", 32, 32 },
 	{ "UserParser", 4096, 256 },
@@ -27,6 +27,7 @@
 #include "PreRTS.h"	// This must go first in EVERY cpp file int the GameEngine
 
 #include "Common/SubsystemInterface.h"
+#include "Common/StartupTimeline.h"
 #include "Common/Xfer.h"
 
 
@@ -144,9 +145,15 @@ void SubsystemInterfaceList::removeSubsystem(SubsystemInterface* sys)
 //-----------------------------------------------------------------------------
 void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char* path1, const char* path2, const char* dirpath, Xfer *pXfer, AsciiString name)
 {
+	if (TheStartupTimeline)
+		TheStartupTimeline->beginSubsystem(name);
+
 	sys->setName(name);
 	sys->init();
 
+	if (TheStartupTimeline)
+		TheStartupTimeline->endSubsystemInit();
+
 	INI ini;
 	if (path1)
 		ini.load(path1, INI_LOAD_OVERWRITE, pXfer );
@@ -155,6 +162,9 @@ void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char*
 	if (dirpath)
 		ini.loadDirectory(dirpath, TRUE, INI_LOAD_OVERWRITE, pXfer );
 
+	if (TheStartupTimeline)
+		TheStartupTimeline->endSubsystem();
+
 	m_subsystems.push_back(sys);
 }
 
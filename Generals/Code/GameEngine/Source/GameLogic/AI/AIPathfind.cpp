@@ -1079,6 +1079,7 @@ Real Path::computeFlightDistToGoal( const Coord3D *pos, Coord3D& goalPos )
 //-----------------------------------------------------------------------------------
 
 enum { PATHFIND_CELLS_PER_FRAME=5000}; // Number of cells we will search pathfinding per frame.
+enum { PATHFIND_MAX_QUEUE_WAIT=LOGICFRAMES_PER_SECOND}; // Requests that waited this many frames are served first, whatever their class.
 enum {CELL_INFOS_TO_ALLOCATE = 30000};
 PathfindCellInfo *PathfindCellInfo::s_infoArray = NULL;
 PathfindCellInfo *PathfindCellInfo::s_firstFree = NULL;						
@@ -1935,6 +1936,7 @@ m_interactsWithBridge(FALSE)
 	//Initialization(s) inserted
 	m_firstZone = 0;
 	m_markedPassable = TRUE;
+	m_inCorridor = FALSE;
 	//
 }
 
@@ -2132,6 +2134,11 @@ m_crusherZones(NULL),
 m_hierarchicalZones(NULL), 
 m_blockOfZoneBlocks(NULL),
 m_zoneBlocks(NULL),
+m_passableBlockList(NULL),
+m_passableBlockCount(0),
+m_allBlocksPassable(TRUE),
+m_corridorBlockList(NULL),
+m_corridorBlockCount(0),
 m_zonesAllocated(0)
 {		
 	m_zoneBlockExtent.x = 0;
@@ -2183,6 +2190,17 @@ void PathfindZoneManager::freeBlocks()
 		delete [] m_zoneBlocks;
 		m_zoneBlocks = NULL;
 	}
+	if (m_passableBlockList) {
+		delete [] m_passableBlockList;
+		m_passableBlockList = NULL;
+	}
+	if (m_corridorBlockList) {
+		delete [] m_corridorBlockList;
+		m_corridorBlockList = NULL;
+	}
+	m_passableBlockCount = 0;
+	m_corridorBlockCount = 0;
+	m_allBlocksPassable = TRUE;
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
 }
@@ -2226,6 +2244,12 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
 	}
+	// new blocks start out passable.
+	m_passableBlockList = MSGNEW("PathfindZoneBlocks") ICoord2D[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
+	m_corridorBlockList = MSGNEW("PathfindZoneBlocks") ICoord2D[(m_zoneBlockExtent.x)*(m_zoneBlockExtent.y)];
+	m_passableBlockCount = 0;
+	m_corridorBlockCount = 0;
+	m_allBlocksPassable = TRUE;
 }
 
 void PathfindZoneManager::markZonesDirty(void)  ///< Called when the zones need to be recalculated.
@@ -2552,11 +2576,21 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 void PathfindZoneManager::clearPassableFlags( ) 
 {	Int blockX;
 	Int blockY;
-	for (blockX = 0; blockX<m_zoneBlockExtent.x; blockX++) {
-		for (blockY = 0; blockY<m_zoneBlockExtent.y; blockY++) {
-			m_zoneBlocks[blockX][blockY].setPassable(false);
+	if (m_allBlocksPassable) {
+		for (blockX = 0; blockX<m_zoneBlockExtent.x; blockX++) {
+			for (blockY = 0; blockY<m_zoneBlockExtent.y; blockY++) {
+				m_zoneBlocks[blockX][blockY].setPassable(false);
+			}
+		}
+		m_allBlocksPassable = FALSE;
+	}	else {
+		// Only the blocks that were marked since the last clear need clearing.
+		Int i;
+		for (i=0; i<m_passableBlockCount; i++) {
+			m_zoneBlocks[m_passableBlockList[i].x][m_passableBlockList[i].y].setPassable(false);
 		}
 	}
+	m_passableBlockCount = 0;
 }
 
 //
@@ -2570,6 +2604,61 @@ void PathfindZoneManager::setAllPassable( )
 			m_zoneBlocks[blockX][blockY].setPassable(true);
 		}
 	}
+	m_allBlocksPassable = TRUE;
+	m_passableBlockCount = 0;
+}
+
+//
+// Mark the passable blocks, widened by one block on each side, as the corridor
+// that a corridor restricted pathfind is allowed to search.  Only visits the
+// blocks on the hierarchical route, and returns false if they are not known.
+//
+Bool PathfindZoneManager::markCorridorFromPassable( ) 
+{	Int k;
+	for (k=0; k<m_corridorBlockCount; k++) {
+		m_zoneBlocks[m_corridorBlockList[k].x][m_corridorBlockList[k].y].setInCorridor(false);
+	}
+	m_corridorBlockCount = 0;
+	if (m_allBlocksPassable) {
+		return false;
+	}
+	for (k=0; k<m_passableBlockCount; k++) {
+		Int blockX = m_passableBlockList[k].x;
+		Int blockY = m_passableBlockList[k].y;
+		Int loX = max(blockX-1, 0);
+		Int loY = max(blockY-1, 0);
+		Int hiX = min(blockX+1, m_zoneBlockExtent.x-1);
+		Int hiY = min(blockY+1, m_zoneBlockExtent.y-1);
+		Int i, j;
+		for (i=loX; i<=hiX; i++) {
+			for (j=loY; j<=hiY; j++) {
+				if (!m_zoneBlocks[i][j].isInCorridor()) {
+					m_zoneBlocks[i][j].setInCorridor(true);
+					m_corridorBlockList[m_corridorBlockCount].x = i;
+					m_corridorBlockList[m_corridorBlockCount].y = j;
+					m_corridorBlockCount++;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+//
+// Get the corridor flag for the block at this location.
+//
+Bool PathfindZoneManager::isInCorridor(Int cellX, Int cellY) const
+{
+	Int blockX = cellX/ZONE_BLOCK_SIZE;
+	Int blockY = cellY/ZONE_BLOCK_SIZE;
+
+	if (blockX<0 || blockX>=m_zoneBlockExtent.x) {
+		return false;
+	}
+	if (blockY<0 || blockY>=m_zoneBlockExtent.y) {
+		return false;
+	}
+	return m_zoneBlocks[blockX][blockY].isInCorridor();
 }
 
 //
@@ -2588,7 +2677,18 @@ void PathfindZoneManager::setPassable(Int cellX, Int cellY, Bool passable)
 		DEBUG_CRASH(("Invalid block."));
 		return;
 	}
-	m_zoneBlocks[blockX][blockY].setPassable(passable);
+	ZoneBlock &block = m_zoneBlocks[blockX][blockY];
+	if (passable && !block.isPassable() && !m_allBlocksPassable) {
+		// Remember the block, so that clearing the flags does not have to visit every block.
+		if (m_passableBlockCount < m_zoneBlockExtent.x*m_zoneBlockExtent.y) {
+			m_passableBlockList[m_passableBlockCount].x = blockX;
+			m_passableBlockList[m_passableBlockCount].y = blockY;
+			m_passableBlockCount++;
+		}	else {
+			m_allBlocksPassable = TRUE;
+		}
+	}
+	block.setPassable(passable);
 }
 
 //
@@ -3382,6 +3482,9 @@ void PathfindLayer::classifyWallMapCell( Int i, Int j , PathfindCell *cell, Obje
 Pathfinder::Pathfinder( void ) :m_map(NULL)
 {
 	debugPath = NULL;
+	m_sharedGroupPath = NULL;
+	m_corridorSearchCount = 0;
+	m_corridorLeftCount = 0;
 	PathfindCellInfo::allocateCellInfos();
 	reset();
 }
@@ -3418,6 +3521,13 @@ void Pathfinder::reset( void )
 
 	m_ignoreObstacleID = INVALID_ID;
 	m_isTunneling = false;
+	m_restrictToCorridor = false;
+	m_corridorBorderCells.clear();
+	if (m_corridorSearchCount>0) {
+		DEBUG_LOG(("Pathfinder::reset - %u of %u corridor searches had to leave the corridor.", m_corridorLeftCount, m_corridorSearchCount));
+	}
+	m_corridorSearchCount = 0;
+	m_corridorLeftCount = 0;
 
 	m_moveAlliesDepth = 0;
 
@@ -3437,9 +3547,17 @@ void Pathfinder::reset( void )
 
 	for (m_queuePRHead=0; m_queuePRHead<PATHFIND_QUEUE_LEN; m_queuePRHead++) {
 		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
+		m_queuedPathfindPriorities[m_queuePRHead] = PATHFIND_PRIORITY_AI;
+		m_queuedPathfindFrames[m_queuePRHead] = 0;
 	}
 	m_queuePRHead = 0;
 	m_queuePRTail = 0;
+	for (i=0; i<PATHFIND_PRIORITY_COUNT; ++i) {
+		m_queuedPathfindCounts[i] = 0;
+	}
+	memset(&m_queueStats, 0, sizeof(m_queueStats));
+	m_queueLatencySum = 0;
+	releaseSharedGroupPath();
 
 	m_numWallPieces = 0;
 	for (i=0; i<MAX_WALL_PIECES; ++i)
@@ -5148,7 +5266,7 @@ Bool Pathfinder::adjustToPossibleDestination(Object *obj, const LocomotorSet& lo
  * Queues an object to do a pathfind.
  * It will call the object's ai update->doPathfind() during processPathfindQueue().
  */
-Bool Pathfinder::queueForPath(ObjectID id)
+Bool Pathfinder::queueForPath(ObjectID id, Bool isRepath)
 {
 #ifdef DEBUG_LOGGING
 	{
@@ -5163,10 +5281,18 @@ Bool Pathfinder::queueForPath(ObjectID id)
 	}
 #endif
 	
+	const PathfindRequestPriority priority = getRequestPriority(TheGameLogic->findObjectByID(id), isRepath);
+
 	/* Check & see if we are already queued. */
 	Int slot = m_queuePRHead;
 	while (slot != m_queuePRTail) {
 		if (m_queuedPathfindRequests[slot] == id) {
+			// Keep the place in the queue, but move into the more urgent class.
+			if (priority < m_queuedPathfindPriorities[slot]) {
+				--m_queuedPathfindCounts[m_queuedPathfindPriorities[slot]];
+				++m_queuedPathfindCounts[priority];
+				m_queuedPathfindPriorities[slot] = priority;
+			}
 			return true;
 		}
 		slot++;
@@ -5185,10 +5311,189 @@ Bool Pathfinder::queueForPath(ObjectID id)
 		return false;
 	}
 	m_queuedPathfindRequests[m_queuePRTail] = id;
+	m_queuedPathfindPriorities[m_queuePRTail] = priority;
+	m_queuedPathfindFrames[m_queuePRTail] = TheGameLogic->getFrame();
+	++m_queuedPathfindCounts[priority];
 	m_queuePRTail = nextSlot;
 	return true;
 }
 
+/**
+ * Classify a pathfind request. Units of human players are served before units
+ * of computer players, and both before units that repath after asking too quickly.
+ */
+PathfindRequestPriority Pathfinder::getRequestPriority(const Object *obj, Bool isRepath) const
+{
+	if (isRepath) {
+		return PATHFIND_PRIORITY_REPATH;
+	}
+	if (obj && obj->getControllingPlayer() && (obj->getControllingPlayer()->getPlayerType()==PLAYER_COMPUTER)) {
+		return PATHFIND_PRIORITY_AI;
+	}
+	return PATHFIND_PRIORITY_PLAYER;
+}
+
+/**
+ * Serve the queued pathfind request in the given slot.
+ */
+void Pathfinder::processQueuedPathfind(Int slot)
+{
+	Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[slot]);
+	m_queuedPathfindRequests[slot] = INVALID_ID;
+	--m_queuedPathfindCounts[m_queuedPathfindPriorities[slot]];
+	if (obj) {
+		AIUpdateInterface *ai = obj->getAIUpdateInterface();
+		if (ai) {
+			UnsignedInt latency = TheGameLogic->getFrame() - m_queuedPathfindFrames[slot];
+			m_queueLatencySum += latency;
+			if (latency > m_queueStats.maxLatencyLastFrame) {
+				m_queueStats.maxLatencyLastFrame = latency;
+			}
+			m_queueStats.pathsLastFrame++;
+			ai->doPathfind(this);
+		}
+	}
+}
+
+/**
+ * Requests can be served out of order, which leaves holes in the queue. Close them,
+ * keeping the order of the remaining requests.
+ */
+void Pathfinder::compactPathfindQueue(void)
+{
+	Int writeSlot = m_queuePRHead;
+	Int readSlot = m_queuePRHead;
+	while (readSlot != m_queuePRTail) {
+		if (m_queuedPathfindRequests[readSlot] != INVALID_ID) {
+			if (writeSlot != readSlot) {
+				m_queuedPathfindRequests[writeSlot] = m_queuedPathfindRequests[readSlot];
+				m_queuedPathfindPriorities[writeSlot] = m_queuedPathfindPriorities[readSlot];
+				m_queuedPathfindFrames[writeSlot] = m_queuedPathfindFrames[readSlot];
+				m_queuedPathfindRequests[readSlot] = INVALID_ID;
+			}
+			writeSlot++;
+			if (writeSlot >= PATHFIND_QUEUE_LEN) {
+				writeSlot = 0;
+			}
+		}
+		readSlot++;
+		if (readSlot >= PATHFIND_QUEUE_LEN) {
+			readSlot = 0;
+		}
+	}
+	m_queuePRTail = writeSlot;
+}
+
+/**
+ * Get the pathfind queue statistics.
+ */
+void Pathfinder::getQueueStats(PathfindQueueStats &stats) const
+{
+	stats = m_queueStats;
+	stats.queueDepth = 0;
+	for (Int i=0; i<PATHFIND_PRIORITY_COUNT; ++i) {
+		stats.queueDepthByPriority[i] = m_queuedPathfindCounts[i];
+		stats.queueDepth += m_queuedPathfindCounts[i];
+	}
+}
+
+/**
+ * Fill in the key under which the path of a group member can be shared with its group mates.
+ * Returns false if the object is not in a group.
+ */
+Bool Pathfinder::makeSharedGroupPathKey(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
+	const Coord3D *to, SharedGroupPathKey &key)
+{
+	AIGroup *group = obj ? obj->getGroup() : NULL;
+	if (group == NULL || group->getCount() < 2) {
+		return false;
+	}
+	key.frame = TheGameLogic->getFrame();
+	key.groupID = group->getID();
+	key.thingTemplate = obj->getTemplate();
+	key.player = obj->getControllingPlayer();
+	key.surfaces = locomotorSet.getValidSurfaces();
+	key.ignoreObstacleID = m_ignoreObstacleID;
+	worldToCell(from, &key.startCell);
+	key.startLayer = obj->getLayer();
+	key.goal = *to;
+	return true;
+}
+
+/**
+ * If a group mate of obj, of the same type and standing in the same cell, found a path
+ * to the same destination earlier in this logic frame, return a copy of it.
+ */
+Path *Pathfinder::findSharedGroupPath(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to)
+{
+	if (m_sharedGroupPath == NULL) {
+		return NULL;
+	}
+	SharedGroupPathKey key;
+	if (!makeSharedGroupPathKey(obj, locomotorSet, from, to, key)) {
+		return NULL;
+	}
+	const SharedGroupPathKey &shared = m_sharedGroupPathKey;
+	if (key.frame != shared.frame ||
+			key.groupID != shared.groupID ||
+			key.thingTemplate != shared.thingTemplate ||
+			key.player != shared.player ||
+			key.surfaces != shared.surfaces ||
+			key.ignoreObstacleID != shared.ignoreObstacleID ||
+			key.startCell.x != shared.startCell.x || key.startCell.y != shared.startCell.y ||
+			key.startLayer != shared.startLayer ||
+			key.goal.x != shared.goal.x || key.goal.y != shared.goal.y || key.goal.z != shared.goal.z) {
+		return NULL;
+	}
+	Path *path = copyPathFrom(m_sharedGroupPath, from);
+	path->optimize(obj, locomotorSet.getValidSurfaces(), false);
+	m_queueStats.sharedPathsLastFrame++;
+	return path;
+}
+
+/**
+ * Keep a copy of the path that obj found, so that its group mates can share it.
+ */
+void Pathfinder::rememberSharedGroupPath(Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to, Path *path)
+{
+	releaseSharedGroupPath();
+	if (path->getFirstNode() == NULL || path->getFirstNode()->getNext() == NULL) {
+		return;
+	}
+	if (!makeSharedGroupPathKey(obj, locomotorSet, from, to, m_sharedGroupPathKey)) {
+		return;
+	}
+	m_sharedGroupPath = copyPathFrom(path, from);
+}
+
+void Pathfinder::releaseSharedGroupPath(void)
+{
+	if (m_sharedGroupPath) {
+		deleteInstance(m_sharedGroupPath);
+		m_sharedGroupPath = NULL;
+	}
+}
+
+/**
+ * Copy the nodes of a path, replacing the first node with the given start position.
+ * The copy is not optimized.
+ */
+Path *Pathfinder::copyPathFrom(Path *source, const Coord3D *from)
+{
+	Path *path = newInstance(Path);
+	PathNode *node = source->getLastNode();
+	for ( ; node && node->getPrevious(); node = node->getPrevious()) {
+		path->prependNode(node->getPosition(), node->getLayer());
+		path->getFirstNode()->setCanOptimize(node->getCanOptimize());
+	}
+	if (node) {
+		path->prependNode(from, node->getLayer());
+		path->getFirstNode()->setCanOptimize(node->getCanOptimize());
+	}
+	path->setBlockedByAlly(source->getBlockedByAlly());
+	return path;
+}
+
 #if defined(RTS_DEBUG)
 void Pathfinder::doDebugIcons(void) {
 	const Int FRAMES_TO_SHOW_OBSTACLES = 100;
@@ -5409,31 +5714,64 @@ void Pathfinder::processPathfindQueue(void)
 	m_logicalExtent = bounds;
 
 	m_cumulativeCellsAllocated = 0;	// Number of pathfind cells examined.
-	Int pathsFound = 0;
+	m_queueStats.pathsLastFrame = 0;
+	m_queueStats.sharedPathsLastFrame = 0;
+	m_queueStats.maxLatencyLastFrame = 0;
+	m_queueLatencySum = 0;
+#if RETAIL_COMPATIBLE_CRC
 	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME && 
 		m_queuePRTail!=m_queuePRHead) {
-		Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[m_queuePRHead]);
-		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
-		if (obj) {
-			AIUpdateInterface *ai = obj->getAIUpdateInterface();
-			if (ai) {
-				ai->doPathfind(this);
-				pathsFound++;
-			}
-		}
+		processQueuedPathfind(m_queuePRHead);
 		m_queuePRHead = m_queuePRHead+1;
 		if (m_queuePRHead >= PATHFIND_QUEUE_LEN) {
 			m_queuePRHead = 0;
 		}
 	}
-	if (pathsFound>0) {
+#else
+	// TheSuperHackers @performance alanblack166 18/10/2026 Serve the requests by priority class, and in queue order within
+	// a class, so that mass orders of one player or the repaths of stuck units do not delay everything
+	// else. The budget stays in cells rather than time, because all clients must serve the same requests.
+	// Requests that waited too long are served first, so that no class can starve. The queue is in the
+	// order of the requests, so these are all at its head.
+	Int slot = m_queuePRHead;
+	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME && slot != m_queuePRTail) {
+		if (m_queuedPathfindRequests[slot] != INVALID_ID) {
+			if (TheGameLogic->getFrame() - m_queuedPathfindFrames[slot] < PATHFIND_MAX_QUEUE_WAIT) {
+				break;
+			}
+			processQueuedPathfind(slot);
+		}
+		slot++;
+		if (slot >= PATHFIND_QUEUE_LEN) {
+			slot = 0;
+		}
+	}
+	for (Int priority=0; priority<PATHFIND_PRIORITY_COUNT; ++priority) {
+		slot = m_queuePRHead;
+		while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME && 
+			m_queuedPathfindCounts[priority] > 0 && slot != m_queuePRTail) {
+			if (m_queuedPathfindRequests[slot] != INVALID_ID && m_queuedPathfindPriorities[slot] == priority) {
+				processQueuedPathfind(slot);
+			}
+			slot++;
+			if (slot >= PATHFIND_QUEUE_LEN) {
+				slot = 0;
+			}
+		}
+	}
+	compactPathfindQueue();
+	releaseSharedGroupPath();
+#endif
+	m_queueStats.avgLatencyLastFrame = m_queueStats.pathsLastFrame ? 
+		(Real)m_queueLatencySum / (Real)m_queueStats.pathsLastFrame : 0.0f;
+	if (m_queueStats.pathsLastFrame>0) {
 #ifdef DEBUG_QPF
 #ifdef DEBUG_LOGGING
 		QueryPerformanceCounter((LARGE_INTEGER *)&endTime64);
 		timeToUpdate = ((double)(endTime64-startTime64) / (double)(freq64));
 		if (timeToUpdate>0.01f) 
 		{
-			DEBUG_LOG(("%d Pathfind queue: %d paths, %d cells --", TheGameLogic->getFrame(), pathsFound, m_cumulativeCellsAllocated));
+			DEBUG_LOG(("%d Pathfind queue: %d paths, %d cells --", TheGameLogic->getFrame(), m_queueStats.pathsLastFrame, m_cumulativeCellsAllocated));
 			DEBUG_LOG(("time %f (%f)", timeToUpdate, (::GetTickCount()-startTimeMS)/1000.0f));
 		}
 #endif
@@ -5642,6 +5980,7 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 		Bool neighborFlags[8] = { 0 };
 
 		UnsignedInt newCostSoFar = 0;
+		Bool leftCorridor = false;
 
 
 
@@ -5663,6 +6002,16 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 			if ((newCell->getLayer()==LAYER_GROUND) && !m_zoneManager.isPassable(newCellCoord.x, newCellCoord.y)) {
 				notZonePassable = true;
 			}
+#if !RETAIL_COMPATIBLE_CRC
+			if (m_restrictToCorridor && (newCell->getLayer()==LAYER_GROUND) && !m_zoneManager.isInCorridor(newCellCoord.x, newCellCoord.y)) {
+				if (!leftCorridor) {
+					// Come back to this cell if the search has to leave the corridor.
+					m_corridorBorderCells.push_back(parentCell);
+					leftCorridor = true;
+				}
+				continue;
+			}
+#endif
 			if (isHuman) {
 				// check if new cell is in logical map.	(computer can move off logical map)
 				if (newCellCoord.x < m_logicalExtent.lo.x) continue;
@@ -5870,6 +6219,14 @@ Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const
 	if (!quickDoesPathExist(locomotorSet, from, rawTo)) {
 		return NULL;
 	}
+#if !RETAIL_COMPATIBLE_CRC
+	// TheSuperHackers @performance alanblack166 18/10/2026 Units of a group that start in the same cell and go to the same
+	// destination get a copy of the path that the first of them found in this frame.
+	Path *sharedPath = findSharedGroupPath(obj, locomotorSet, from, rawTo);
+	if (sharedPath!=NULL) {
+		return sharedPath;
+	}
+#endif
 	Bool isHuman = true;
 	if (obj && obj->getControllingPlayer() && (obj->getControllingPlayer()->getPlayerType()==PLAYER_COMPUTER)) {
 		isHuman = false; // computer gets to cheat.
@@ -5877,14 +6234,38 @@ Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const
 
 	m_zoneManager.clearPassableFlags();
 	Path *hPat = findHierarchicalPath(isHuman, locomotorSet, from, rawTo, false);
+	Bool gotHierarchicalPath = false;
 	if (hPat) {
 		deleteInstance(hPat);
+		gotHierarchicalPath = true;
 	}	else {
 		m_zoneManager.setAllPassable();
 	}
 
+#if !RETAIL_COMPATIBLE_CRC
+	// TheSuperHackers @performance alanblack166 18/10/2026 The zone block path above plans the route at block level. Refine it
+	// with a cell search that only expands the blocks along that route and their direct neighbors,
+	// instead of merely penalizing the cells outside of it, which still fills the open list with them
+	// on large maps. If the corridor is too tight, for example because of units, the search continues
+	// outside of it, see internalFindPath. All decisions are made on integer costs, so it stays deterministic.
+	if (gotHierarchicalPath && m_zoneManager.markCorridorFromPassable()) {
+		m_corridorSearchCount++;
+		m_restrictToCorridor = true;
+		Path *corridorPath = internalFindPath(obj, locomotorSet, from, rawTo);
+		m_restrictToCorridor = false;
+		m_corridorBorderCells.clear();
+		if (corridorPath!=NULL) {
+			rememberSharedGroupPath(obj, locomotorSet, from, rawTo, corridorPath);
+		}
+		return corridorPath;
+	}
+#endif
+
 	Path *pat = internalFindPath(obj, locomotorSet, from, rawTo);
 	if (pat!=NULL) {
+#if !RETAIL_COMPATIBLE_CRC
+		rememberSharedGroupPath(obj, locomotorSet, from, rawTo, pat);
+#endif
 		return pat;
 	}
 
@@ -6133,6 +6514,19 @@ Path *Pathfinder::internalFindPath( Object *obj, const LocomotorSet& locomotorSe
 
 		cellCount += examineNeighboringCells(parentCell, goalCell, locomotorSet, isHuman, centerInCell, radius, startCellNdx, obj, NO_ATTACK);
 
+#if !RETAIL_COMPATIBLE_CRC
+		if (m_openList == NULL && m_restrictToCorridor) {
+			// The corridor is blocked.  Continue into the cells outside of it from the searched cells
+			// next to them, instead of searching all the cells of the corridor again.
+			m_restrictToCorridor = false;
+			m_corridorLeftCount++;
+			std::vector<PathfindCell*>::const_iterator it;
+			for (it = m_corridorBorderCells.begin(); it != m_corridorBorderCells.end(); ++it) {
+				cellCount += examineNeighboringCells(*it, goalCell, locomotorSet, isHuman, centerInCell, radius, startCellNdx, obj, NO_ATTACK);
+			}
+			m_corridorBorderCells.clear();
+		}
+#endif
 	}
 
 	// failure - goal cannot be reached
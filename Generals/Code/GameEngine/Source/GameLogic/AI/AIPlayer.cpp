@@ -2196,7 +2196,7 @@ void AIPlayer::buildSpecificAITeam( TeamPrototype *teamProto, Bool priorityBuild
 			if (team->m_team->getPrototype()->getTemplateInfo()->m_executeActions) {
 				const Script *script = TheScriptEngine->findScriptByName(team->m_team->getPrototype()->getTemplateInfo()->m_productionCondition);
 				if (script && script->getAction()) {
-					TheScriptEngine->friend_executeAction(script->getAction(), team->m_team);
+					TheScriptEngine->friend_executeAction(script->getAction(), team->m_team, script);
 				}
 			}
 		} else {
@@ -2562,7 +2562,7 @@ void AIPlayer::checkQueuedTeams( void )
 				if (team->m_team->getPrototype()->getTemplateInfo()->m_executeActions) {
 					const Script *script = TheScriptEngine->findScriptByName(team->m_team->getPrototype()->getTemplateInfo()->m_productionCondition);
 					if (script) {
-						TheScriptEngine->friend_executeAction(script->getAction(), team->m_team);
+						TheScriptEngine->friend_executeAction(script->getAction(), team->m_team, script);
 					}
 				}
 			}	
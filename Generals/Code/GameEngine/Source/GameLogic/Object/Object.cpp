@@ -1610,6 +1610,10 @@ void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPo
   	m_drawable->setTransformMatrix( this->getTransformMatrix() );
 	}
 
+	// the partition manager keeps its own copy of every position for its distance checks.
+	if (m_partitionData)
+		m_partitionData->updatePosition();
+
 	Bool posDiff = isPosDifferent(oldPos, getPosition());
 	Bool angDiff = isAngleDifferent(oldAngle, getOrientation());
 
@@ -1775,6 +1779,9 @@ void Object::healCompletely()
 //-------------------------------------------------------------------------------------------------
 void Object::setEffectivelyDead(Bool dead)
 {
+	if (dead != isEffectivelyDead() && TheScriptEngine)
+		TheScriptEngine->notifyOfObjectDeathChange(this);
+
 	if (dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
@@ -1062,7 +1062,7 @@ UpdateSleepTime AIUpdateInterface::update( void )
 	{
 		if (now >= m_queueForPathFrame) 
 		{
-			TheAI->pathfinder()->queueForPath(getObject()->getID());
+			TheAI->pathfinder()->queueForPath(getObject()->getID(), TRUE);
 			setQueueForPathTime(0);
 		}
 		else
@@ -202,13 +202,13 @@ void ScriptConditions::objectTypesFromParam(Parameter *pTypeParm, ObjectTypes *o
 		return;
 	}
 
-	AsciiString str = pTypeParm->getString();
+	const AsciiString& str = pTypeParm->getString();
 
 	if (str.isEmpty()) {
 		return;
 	}
 
-	ObjectTypes *types = TheScriptEngine->getObjectTypes(str);
+	ObjectTypes *types = TheScriptEngine->getObjectTypes(pTypeParm);
 	if (!types) {
 		(*outObjectTypes).addObjectType(str);
 	} else {
@@ -246,7 +246,7 @@ Bool ScriptConditions::evaluateAllBuildFacilitiesDestroyed(Parameter *pSideParm
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateIsDestroyed(Parameter *pTeamParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	if (theTeam) {
@@ -264,7 +264,7 @@ Bool ScriptConditions::evaluateBridgeBroken(Parameter *pBridgeParm)
 		// Don't bother checking if no bridges changed damage states.
 		return false;
 	}
-	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm->getString() );
+	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm );
 	if (theBridge) {
 		return (TheTerrainLogic->isBridgeBroken(theBridge));
 	}
@@ -280,7 +280,7 @@ Bool ScriptConditions::evaluateBridgeRepaired(Parameter *pBridgeParm)
 		// Don't bother checking if no bridges changed damage states.
 		return false;
 	}
-	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm->getString() );
+	Object *theBridge = TheScriptEngine->getUnitNamed( pBridgeParm );
 	if (theBridge) {
 		return (TheTerrainLogic->isBridgeRepaired(theBridge));
 	}
@@ -292,13 +292,13 @@ Bool ScriptConditions::evaluateBridgeRepaired(Parameter *pBridgeParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitDestroyed(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit) 
 	{
 		return theUnit->isEffectivelyDead();
 	}
 
-	if (TheScriptEngine->didUnitExist(pUnitParm->getString())) {
+	if (TheScriptEngine->didUnitExist(pUnitParm)) {
 		return true;
 	}
 	return false; // Non existent unit is not destroyed. 
@@ -309,7 +309,7 @@ Bool ScriptConditions::evaluateNamedUnitDestroyed(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitExists(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit) 
 	{
 		return !theUnit->isEffectivelyDead();
@@ -323,13 +323,13 @@ Bool ScriptConditions::evaluateNamedUnitExists(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitDying(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit) 
 	{
 		return theUnit->isEffectivelyDead();
 	}
 
-	if (TheScriptEngine->didUnitExist(pUnitParm->getString())) 
+	if (TheScriptEngine->didUnitExist(pUnitParm)) 
 	{
 		return false; // already totally killed
 	}
@@ -341,12 +341,12 @@ Bool ScriptConditions::evaluateNamedUnitDying(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedUnitTotallyDead(Parameter *pUnitParm)
 {
-	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theUnit = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (theUnit) {
 		return false; // if the unit still exists, it isn't totally dead.
 	}
 
-	if (TheScriptEngine->didUnitExist(pUnitParm->getString())) {
+	if (TheScriptEngine->didUnitExist(pUnitParm)) {
 		// Did exist, now it doesnt.  So it is really, really dead.
 		return true; // totally killed
 	}
@@ -396,11 +396,11 @@ Bool ScriptConditions::evaluateHasUnits(Parameter *pTeamParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamInsideAreaPartially(Parameter *pTeamParm, Parameter *pTriggerAreaParm, Parameter *pTypeParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString triggerName = pTriggerAreaParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm);
 	
 	if (pTrig == NULL) return false;
 	if (theTeam) {
@@ -415,14 +415,14 @@ Bool ScriptConditions::evaluateTeamInsideAreaPartially(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedInsideArea(Parameter *pUnitParm, Parameter *pTriggerAreaParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 
 	if (!theObj) {
 		return false;
 	}
 
 	AsciiString triggerName = pTriggerAreaParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerAreaParm);
 	if (pTrig == NULL) return false;
 	if (theObj) {
 		Coord3D pCoord = *theObj->getPosition();
@@ -439,7 +439,7 @@ Bool ScriptConditions::evaluateNamedInsideArea(Parameter *pUnitParm, Parameter *
 Bool ScriptConditions::evaluatePlayerHasUnitTypeInArea(Condition *pCondition, Parameter *pPlayerParm, Parameter *pComparisonParm, Parameter *pCountParm, Parameter *pTypeParm, Parameter *pTriggerParm )
 {
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (pTrig == NULL) return false;
 
 	Player* pPlayer = playerFromParam(pPlayerParm);
@@ -531,7 +531,7 @@ Bool ScriptConditions::evaluatePlayerHasUnitTypeInArea(Condition *pCondition, Pa
 Bool ScriptConditions::evaluatePlayerHasUnitKindInArea(Condition *pCondition, Parameter *pPlayerParm, Parameter *pComparisonParm, Parameter *pCountParm, Parameter *pKindParm, Parameter *pTriggerParm )
 {
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (pTrig == NULL) return false;
 
 	KindOfType kind = (KindOfType)pKindParm->getInt();
@@ -611,7 +611,7 @@ Bool ScriptConditions::evaluatePlayerHasUnitKindInArea(Condition *pCondition, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamStateIs(Parameter *pTeamParm, Parameter *pStateParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString stateName = pStateParm->getString();
@@ -627,7 +627,7 @@ Bool ScriptConditions::evaluateTeamStateIs(Parameter *pTeamParm, Parameter *pSta
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamStateIsNot(Parameter *pTeamParm, Parameter *pStateParm )
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString stateName = pStateParm->getString();
@@ -651,11 +651,11 @@ Bool ScriptConditions::evaluateNamedOutsideArea(Parameter *pUnitParm, Parameter
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamInsideAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {// This is actually TeamInside(...)
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	// The team is the team based on the name, and the calling team (if any) and the team that
 	// is being considered for the condition.  jba. :)
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	
 	if (pTrig == NULL) 
 		return false;
@@ -680,7 +680,7 @@ Bool ScriptConditions::evaluateTeamOutsideAreaEntirely(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedAttackedByType(Parameter *pUnitParm, Parameter *pTypeParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -713,7 +713,7 @@ Bool ScriptConditions::evaluateNamedAttackedByType(Parameter *pUnitParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamAttackedByType(Parameter *pTeamParm, Parameter *pTypeParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!theTeam) {
 		return FALSE;
 	}
@@ -757,7 +757,7 @@ Bool ScriptConditions::evaluateTeamAttackedByType(Parameter *pTeamParm, Paramete
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedAttackedByPlayer(Parameter *pUnitParm, Parameter *pPlayerParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -795,7 +795,7 @@ Bool ScriptConditions::evaluateNamedAttackedByPlayer(Parameter *pUnitParm, Param
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamAttackedByPlayer(Parameter *pTeamParm, Parameter *pPlayerParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *theTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!theTeam) {
 		return false;
 	}
@@ -881,7 +881,7 @@ Bool ScriptConditions::evaluateNamedCreated(Parameter* pUnitParm)
 {
 	// This is actually evaluateNamedExists(...)
 	///@todo - evaluate created, not exists...
-	return (TheScriptEngine->getUnitNamed(pUnitParm->getString()) != NULL);
+	return (TheScriptEngine->getUnitNamed(pUnitParm) != NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -889,7 +889,7 @@ Bool ScriptConditions::evaluateNamedCreated(Parameter* pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamCreated(Parameter* pTeamParm)
 {
-	Team *pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team *pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (pTeam) {
 		return pTeam->isCreated();
 	}
@@ -901,7 +901,7 @@ Bool ScriptConditions::evaluateTeamCreated(Parameter* pTeamParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHealth(Parameter *pUnitParm, Parameter* pComparisonParm, Parameter *pHealthPercent)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -954,7 +954,7 @@ Bool ScriptConditions::evaluatePlayerHasCredits(Parameter *pCreditsParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateBuildingEntered( Parameter *pPlayerParm, Parameter *pItemParm )
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -986,7 +986,7 @@ Bool ScriptConditions::evaluateBuildingEntered( Parameter *pPlayerParm, Paramete
 Bool ScriptConditions::evaluateIsBuildingEmpty( Parameter *pItemParm )
 {
 
-	Object *theBuilding = TheScriptEngine->getUnitNamed(pItemParm->getString());
+	Object *theBuilding = TheScriptEngine->getUnitNamed(pItemParm);
 	if (!theBuilding) {
 		return false;
 	}
@@ -1007,7 +1007,7 @@ Bool ScriptConditions::evaluateIsBuildingEmpty( Parameter *pItemParm )
 Bool ScriptConditions::evaluateEnemySighted(Parameter *pItemParm, Parameter *pAllianceParm, Parameter* pPlayerParm)
 {
 
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1068,7 +1068,7 @@ Bool ScriptConditions::evaluateEnemySighted(Parameter *pItemParm, Parameter *pAl
 Bool ScriptConditions::evaluateTypeSighted(Parameter *pItemParm, Parameter *pTypeParm, Parameter* pPlayerParm)
 {
 
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1113,7 +1113,7 @@ Bool ScriptConditions::evaluateTypeSighted(Parameter *pItemParm, Parameter *pTyp
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedDiscovered(Parameter *pItemParm, Parameter* pPlayerParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pItemParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1144,7 +1144,7 @@ Bool ScriptConditions::evaluateNamedDiscovered(Parameter *pItemParm, Parameter*
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamDiscovered(Parameter *pTeamParm, Parameter *pPlayerParm)
 {	
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -1202,7 +1202,7 @@ Bool ScriptConditions::evaluateNamedOwnedByPlayer(Parameter *pUnitParm, Paramete
 		return false;
 	}
 
-	Object* pObj = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pObj = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pObj) {
 		return false;
 	}
@@ -1220,7 +1220,7 @@ Bool ScriptConditions::evaluateTeamOwnedByPlayer(Parameter *pTeamParm, Parameter
 		return false;
 	}
 
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
@@ -1280,7 +1280,7 @@ Bool ScriptConditions::evaluatePlayerHasPower(Parameter *pPlayerParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedReachedWaypointsEnd(Parameter *pUnitParm, Parameter* pWaypointPathParm)
 {
-	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm->getString() );
+	Object *theObj = TheScriptEngine->getUnitNamed( pUnitParm );
 	if (!theObj) {
 		return false;
 	}
@@ -1307,7 +1307,7 @@ Bool ScriptConditions::evaluateNamedReachedWaypointsEnd(Parameter *pUnitParm, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamReachedWaypointsEnd(Parameter *pTeamParm, Parameter* pWaypointPathParm)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -1425,7 +1425,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitTriggered(Parameter *pP
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1450,7 +1450,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitMidway(Parameter *pPlay
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1475,7 +1475,7 @@ Bool ScriptConditions::evaluatePlayerSpecialPowerFromUnitComplete(Parameter *pPl
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1500,7 +1500,7 @@ Bool ScriptConditions::evaluateUpgradeFromUnitComplete(Parameter *pPlayerParm, P
 	ObjectID sourceID = INVALID_ID;
 	if (pUnitParm)
 	{
-		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+		Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 		if (!pUnit)
 		{
 			// we cared about the source object, but it is dead.  No sense checking anymore, since we don't know it's objectID anymore. :P
@@ -1567,7 +1567,7 @@ Bool ScriptConditions::evaluateSciencePurchasePoints(Parameter *pPlayerParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter *pTriggerParm)
 {
-	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pUnit) {
 		return false;
 	}
@@ -1576,7 +1576,7 @@ Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1590,12 +1590,12 @@ Bool ScriptConditions::evaluateNamedEnteredArea(Parameter *pUnitParm, Parameter
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateNamedExitedArea(Parameter *pUnitParm, Parameter *pTriggerParm)
 {
-	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object* pUnit = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!pUnit) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1609,12 +1609,12 @@ Bool ScriptConditions::evaluateNamedExitedArea(Parameter *pUnitParm, Parameter *
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamEnteredAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (pTrig) {
 		return pTeam->didAllEnter(pTrig, (UnsignedInt)pTypeParm->getInt());
@@ -1628,12 +1628,12 @@ Bool ScriptConditions::evaluateTeamEnteredAreaEntirely(Parameter *pTeamParm, Par
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamEnteredAreaPartially(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (pTrig) {
 		return pTeam->didPartialEnter(pTrig, (UnsignedInt)pTypeParm->getInt());
@@ -1647,12 +1647,12 @@ Bool ScriptConditions::evaluateTeamEnteredAreaPartially(Parameter *pTeamParm, Pa
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamExitedAreaEntirely(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1666,12 +1666,12 @@ Bool ScriptConditions::evaluateTeamExitedAreaEntirely(Parameter *pTeamParm, Para
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamExitedAreaPartially(Parameter *pTeamParm, Parameter *pTriggerParm, Parameter *pTypeParm)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -1874,7 +1874,7 @@ Bool ScriptConditions::evaluatePlayerDestroyedNOrMoreBuildings(Parameter *pPlaye
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHasEmptied(Parameter *pUnitParm)
 {
-	Object *object = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object *object = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!object) {
 		return false;
 	}
@@ -1923,7 +1923,7 @@ Bool ScriptConditions::evaluateUnitHasEmptied(Parameter *pUnitParm)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamIsContained(Parameter *pTeamParm, Bool allContained)
 {
-	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm->getString());
+	Team* pTeam = TheScriptEngine->getTeamNamed(pTeamParm);
 	if (!pTeam) {
 		return false;
 	}
@@ -1968,7 +1968,7 @@ Bool ScriptConditions::evaluateTeamIsContained(Parameter *pTeamParm, Bool allCon
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateUnitHasObjectStatus(Parameter *pUnitParm, Parameter *pObjectStatus)
 {
-	Object *object = TheScriptEngine->getUnitNamed(pUnitParm->getString());
+	Object *object = TheScriptEngine->getUnitNamed(pUnitParm);
 	if (!object) {
 		return false;
 	}
@@ -1979,7 +1979,7 @@ Bool ScriptConditions::evaluateUnitHasObjectStatus(Parameter *pUnitParm, Paramet
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateTeamHasObjectStatus(Parameter *pTeamParm, Parameter *pObjectStatus, Bool entireTeam)
 {
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -2023,7 +2023,7 @@ Bool ScriptConditions::evaluateSkirmishValueInArea(Condition *pCondition, Parame
 	}
 
 	AsciiString triggerName = pTriggerParm->getString();
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 
 	if (!pTrig) {
 		return false;
@@ -2118,7 +2118,7 @@ Bool ScriptConditions::evaluateSkirmishSuppliesWithinDistancePerimeter(Parameter
 		return false;
 	}
 
-	PolygonTrigger *trigger = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm->getString());
+	PolygonTrigger *trigger = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm);
 	if (!trigger) {
 		return false;
 	}
@@ -2169,7 +2169,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerTechBuildingWithinDistancePerimeter
 	if (pCondition->getCustomData()==1) return true;
 	if (pCondition->getCustomData()==-1) return false;
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pLocationParm);
 	if (!pTrig) {
 		return false;
 	}
@@ -2198,7 +2198,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerTechBuildingWithinDistancePerimeter
 Bool ScriptConditions::evaluateSkirmishCommandButtonIsReady( Parameter * /* pSkirmishPlayerParm */, Parameter *pTeamParm, Parameter *pCommandButtonParm, Bool allReady )
 {
 	// In this one case, the pSkirmishPlayerParm isn't used.
-	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm->getString() );
+	Team *theTeam = TheScriptEngine->getTeamNamed( pTeamParm );
 	if (!theTeam) {
 		return false;
 	}
@@ -2393,7 +2393,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerHasComparisonCapturedUnits(Paramete
 //-------------------------------------------------------------------------------------------------
 Bool ScriptConditions::evaluateSkirmishNamedAreaExists(Parameter *, Parameter *pTriggerParm)
 {
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	return (pTrig != NULL);
 }
 
@@ -2405,7 +2405,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerHasUnitsInArea(Condition *pConditio
 		return FALSE;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (!pTrig) {
 		return FALSE;
 	}
@@ -2526,7 +2526,7 @@ Bool ScriptConditions::evaluateSkirmishPlayerIsOutsideArea(Condition *pCondition
 		return FALSE;
 	}
 
-	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm->getString());
+	PolygonTrigger *pTrig = TheScriptEngine->getQualifiedTriggerAreaByName(pTriggerParm);
 	if (!pTrig) {
 		return FALSE;
 	}
@@ -38,6 +38,7 @@
 #include "Common/PerfTimer.h"
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
+#include "Common/ScriptProfiler.h"
 #include "Common/Team.h"
 #include "Common/ThingFactory.h"
 #include "Common/ThingTemplate.h"
@@ -378,6 +379,17 @@ m_fadeFramesDecrease(0),
 m_fadeFramesHold(0),
 m_fadeFramesIncrease(0),
 m_firstUpdate(TRUE),
+m_benchmarkFrames(0),
+m_benchmarkTotalTicks(0),
+m_benchmarkMinTicks(0),
+m_benchmarkMaxTicks(0),
+m_parameterGeneration(1),
+m_conditionChangeSerial(0),
+m_conditionWakeSerial(0),
+m_namedObjectsChangeSerial(0),
+m_uiInteractionsChangeSerial(0),
+m_conditionDependencies(NULL),
+m_conditionsTrackable(FALSE),
 m_maxFade(0.0f),
 m_minFade(0.0f),
 m_numAttackInfo(0),
@@ -422,6 +434,9 @@ ScriptEngine::~ScriptEngine()
 #endif
 
 	reset(); // just in case.
+
+	delete TheScriptProfiler;
+	TheScriptProfiler = NULL;
 }  // end ~ScriptEngine
 
 //-------------------------------------------------------------------------------------------------
@@ -429,6 +444,20 @@ ScriptEngine::~ScriptEngine()
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::init( void )
 {
+	// TheSuperHackers @feature alanblack166 18/10/2026 Profile the scripts when asked to on the command line. A process that hands
+	// its replays to worker processes runs no scripts; the workers write the profiles instead.
+	const Bool startsReplayWorkers = !TheGlobalData->m_simulateReplays.empty() && TheGlobalData->m_simulateReplayJobs != SIMULATE_REPLAYS_SEQUENTIAL;
+	if (!TheGlobalData->m_scriptProfileFile.isEmpty() && TheScriptProfiler == NULL && !startsReplayWorkers)
+	{
+		TheScriptProfiler = NEW ScriptProfiler;
+		if (!TheScriptProfiler->open(TheGlobalData->m_scriptProfileFile))
+		{
+			DEBUG_LOG(("ScriptEngine::init - Cannot write the script profile to '%s'", TheGlobalData->m_scriptProfileFile.str()));
+			delete TheScriptProfiler;
+			TheScriptProfiler = NULL;
+		}
+	}
+
 	if (TheGlobalData->m_windowed)
 		if (TheGlobalData->m_scriptDebug) {
 			st_DebugDLL = LoadLibrary("DebugWindow.dll");
@@ -4535,6 +4564,9 @@ void ScriptEngine::init( void )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::reset( void )
 {
+	if (TheScriptProfiler)
+		TheScriptProfiler->endGame();
+
 	// setting FPS limit in case a script had changed it
 	if (TheGameEngine && TheGlobalData)
 		TheGameEngine->setFramesPerSecondLimit(TheGlobalData->m_framesPerSecondLimit);
@@ -4553,6 +4585,8 @@ void ScriptEngine::reset( void )
 
 	m_callingTeam = NULL;
 	m_callingObject = NULL;
+	++m_parameterGeneration;
+	wakeAllScripts();
 	m_conditionTeam = NULL;
 	m_conditionObject = NULL;
 	m_currentPlayer = NULL;
@@ -4566,10 +4600,12 @@ void ScriptEngine::reset( void )
 		m_counters[i].value = 0;
 		m_counters[i].isCountdownTimer = false;
 		m_counters[i].name.clear();
+		m_counters[i].changeSerial = 0;
 	}
 	for (i=0; i<MAX_FLAGS; i++) {
 		m_flags[i].value = false;
 		m_flags[i].name.clear();
+		m_flags[i].changeSerial = 0;
 	}
 
 	m_breezeInfo.m_direction = PI/3;
@@ -4666,7 +4702,7 @@ void ScriptEngine::reset( void )
 	m_namedReveals.clear();
 	
 	// Clear the named objects list.
- 	m_namedObjects.clear();
+	clearNamedObjects();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -4701,17 +4737,22 @@ void ScriptEngine::reset( void )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::newMap( void )
 {
+	if (TheScriptProfiler)
+		TheScriptProfiler->beginGame(TheGlobalData->m_mapName);
+
 	m_numCounters = 1;
 	Int i;
 	for (i=0; i<MAX_COUNTERS; i++) {
 		m_counters[i].value = 0;
 		m_counters[i].isCountdownTimer = false;
 		m_counters[i].name.clear();
+		m_counters[i].changeSerial = 0;
 	}
 	m_numFlags = 1;
 	for (i=0; i<MAX_FLAGS; i++) {
 		m_flags[i].value = false;
 		m_flags[i].name.clear();
+		m_flags[i].changeSerial = 0;
 	}
 	m_endGameTimer = -1;
 	m_closeWindowTimer = -1;
@@ -4736,6 +4777,10 @@ void ScriptEngine::newMap( void )
 		m_completedUpgrades[i].clear();
 	}
 
+	// The trigger areas of the previous map are gone.
+	++m_parameterGeneration;
+	wakeAllScripts();
+
 	/* Run through scripts & set condition team names. */
 	for (i=0; i<TheSidesList->getNumSides(); i++) {
 		ScriptList *pSL = TheSidesList->getSideInfo(i)->getScriptList();
@@ -4744,11 +4789,13 @@ void ScriptEngine::newMap( void )
 		Script *pScr;
 		for (pScr = pSL->getScript(); pScr; pScr=pScr->getNext()) {
 			checkConditionsForTeamNames(pScr);
+			bindConditionParameters(pScr);
 		}
 		ScriptGroup *pGroup;
 		for (pGroup = pSL->getScriptGroup(); pGroup; pGroup=pGroup->getNext()) {
 			for (pScr = pGroup->getScript(); pScr; pScr=pScr->getNext()) {
 				checkConditionsForTeamNames(pScr);
+				bindConditionParameters(pScr);
 			}
 		}
 	}	
@@ -4840,6 +4887,7 @@ void ScriptEngine::update( void )
 			// If counter has any time left, decrement.  Counters go to -1 and stop.
 			if (m_counters[i].value >= 0) {
 				m_counters[i].value--;
+				noteCounterChanged(i);
 			}
 		}
 	}
@@ -4858,6 +4906,7 @@ void ScriptEngine::update( void )
 			if (pGroup->isSubroutine()) {
 				continue; // Don't execute subroutine groups.
 			}
+			SCRIPT_PROFILE_SCOPE(group, pGroup, "Group", pGroup->getName(), ScriptProfiler::PHASE_GROUP);
 			executeScripts(pGroup->getScript());
 		}
 		m_currentPlayer = NULL;
@@ -4868,7 +4917,10 @@ void ScriptEngine::update( void )
 	ThePlayerList->updateTeamStates();
 
 	// Clear the UI Interaction flags.
-	m_uiInteractions.clear();
+	if (!m_uiInteractions.empty()) {
+		m_uiInteractions.clear();
+		noteUIInteractionsChanged();
+	}
 
 	// update all sequential stuff.
 	evaluateAndProgressAllSequentialScripts();
@@ -4909,6 +4961,47 @@ void ScriptEngine::update( void )
 
 }  // end update
 
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature alanblack166 18/10/2026 Runs update and times it, for the map that
+	* -benchmarkScripts started. After the requested number of logic frames, prints the timings
+	* and quits the game. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::updateBenchmark( void )
+{
+	LARGE_INTEGER startTicks;
+	LARGE_INTEGER endTicks;
+	QueryPerformanceCounter(&startTicks);
+	update();
+	QueryPerformanceCounter(&endTicks);
+
+	const Int64 ticks = endTicks.QuadPart - startTicks.QuadPart;
+	if (m_benchmarkFrames == 0 || ticks < m_benchmarkMinTicks)
+		m_benchmarkMinTicks = ticks;
+	if (m_benchmarkFrames == 0 || ticks > m_benchmarkMaxTicks)
+		m_benchmarkMaxTicks = ticks;
+	m_benchmarkTotalTicks += ticks;
+	++m_benchmarkFrames;
+
+	if (m_benchmarkFrames != (UnsignedInt)TheGlobalData->m_benchmarkScriptFrames)
+		return;
+
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	const double ticksToMs = 1000.0 / (double)freq.QuadPart;
+	const double totalMs = (double)m_benchmarkTotalTicks * ticksToMs;
+
+	// Note that we use printf here because this is run from cmd.
+	printf("ScriptEngine::update on %s for %u frames, %d named objects: total %.2f ms, average %.4f ms, min %.4f ms, max %.4f ms\n",
+		TheGlobalData->m_initialFile.str(), m_benchmarkFrames, (Int)m_namedObjects.size(), totalMs, totalMs / m_benchmarkFrames,
+		(double)m_benchmarkMinTicks * ticksToMs, (double)m_benchmarkMaxTicks * ticksToMs);
+	fflush(stdout);
+	DEBUG_LOG(("ScriptEngine::update on %s for %u frames: total %.2f ms, average %.4f ms, min %.4f ms, max %.4f ms",
+		TheGlobalData->m_initialFile.str(), m_benchmarkFrames, totalMs, totalMs / m_benchmarkFrames,
+		(double)m_benchmarkMinTicks * ticksToMs, (double)m_benchmarkMaxTicks * ticksToMs));
+
+	TheGameEngine->setQuitting(TRUE);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** getStats */
 //-------------------------------------------------------------------------------------------------
@@ -5045,6 +5138,7 @@ void ScriptEngine::clearFlag(const AsciiString &name)
 		for (i=1; i<m_numFlags; i++) {
 			if ((modName==m_flags[i].name)) {
 				m_flags[i].value = FALSE;
+				noteFlagChanged(i);
 			}
 		}
 	}
@@ -5163,6 +5257,21 @@ ObjectTypes *ScriptEngine::getObjectTypes(const AsciiString& objectTypeList)
 	return NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Same as above, with the object type list the parameter is bound to. Creating or removing a list
+rebinds the parameters, so an unbound list means that the parameter names a single object type. */
+//-------------------------------------------------------------------------------------------------
+ObjectTypes *ScriptEngine::getObjectTypes(Parameter *pTypeParm)
+{
+	if (pTypeParm->getParameterType() != Parameter::OBJECT_TYPE) {
+		return getObjectTypes(pTypeParm->getString());
+	}
+	if (pTypeParm->friend_getBindingGeneration() != m_parameterGeneration) {
+		bindParameter(pTypeParm);
+	}
+	return pTypeParm->getObjectTypes();
+}
+
 //-------------------------------------------------------------------------------------------------
 /** doObjectTypeListMaintenance */
 /** If addObject is false, remove the object. If it is true, add the object. */
@@ -5175,6 +5284,7 @@ void ScriptEngine::doObjectTypeListMaintenance(const AsciiString& objectTypeList
 	if (!currentObjectTypeVec) {
 		ObjectTypes *newVec = newInstance(ObjectTypes)(objectTypeList);
 		m_allObjectTypeLists.push_back(newVec);
+		++m_parameterGeneration;
 		currentObjectTypeVec = newVec;
 	}
 
@@ -5237,6 +5347,22 @@ PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( AsciiString name )
 	return trig;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Same as above, with the trigger area the parameter is bound to. The skirmish perimeters depend
+on the current player and are looked up by name every time. */
+//-------------------------------------------------------------------------------------------------
+PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( Parameter *pTriggerParm )
+{
+	if (pTriggerParm->friend_getBindingGeneration() != m_parameterGeneration) {
+		bindParameter(pTriggerParm);
+	}
+	PolygonTrigger *trig = pTriggerParm->getTriggerArea();
+	if (trig) {
+		return trig;
+	}
+	return getQualifiedTriggerAreaByName(pTriggerParm->getString());
+}
+
 
 
 //-------------------------------------------------------------------------------------------------
@@ -5256,6 +5382,36 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 		return m_conditionTeam;
 	}
 	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( teamName );
+	return getTeamFromPrototype(theTeamProto, teamName);
+}  // end getTeamNamed
+
+//-------------------------------------------------------------------------------------------------
+/** Same as above, with the name key the parameter is bound to. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(Parameter *pTeamParm)
+{
+	const NameKeyType nameKey = getBoundNameKey(pTeamParm);
+	TeamPrototype *theTeamProto = NULL;
+	if (nameKey != NAMEKEY_INVALID) {
+		theTeamProto = TheTeamFactory->findTeamPrototype(nameKey);
+	}
+	if (theTeamProto == NULL) {
+		return getTeamNamed(pTeamParm->getString());
+	}
+	if (m_callingTeam && m_callingTeam->getPrototype() == theTeamProto) {
+		return m_callingTeam;
+	}
+	if (m_conditionTeam && m_conditionTeam->getPrototype() == theTeamProto) {
+		return m_conditionTeam;
+	}
+	return getTeamFromPrototype(theTeamProto, pTeamParm->getString());
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the team of the prototype that the scripts refer to by its name. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamFromPrototype(TeamPrototype *theTeamProto, const AsciiString& teamName)
+{
 	if (theTeamProto == NULL) return NULL;
 	if (theTeamProto->getIsSingleton()) {
 		Team *theTeam = theTeamProto->getFirstItemIn_TeamInstanceList();
@@ -5274,7 +5430,7 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 		}
 	}
 	return theTeamProto->getFirstItemIn_TeamInstanceList();
-}  // end getTeamNamed
+}
 
 //-------------------------------------------------------------------------------------------------
 /** getUnitNamed */
@@ -5288,10 +5444,26 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	const Int index = findNamedObject(unitName);
+	if (index >= 0) {
+		return m_namedObjects[index].second;
+	}
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Same as above, with the name key the parameter is bound to. */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamed(Parameter *pUnitParm)
+{
+	const NameKeyType nameKey = getBoundNameKey(pUnitParm);
+	if (nameKey == NAMEKEY_INVALID) {
+		return getUnitNamed(pUnitParm->getString());
+	}
+
+	const Int index = findNamedObject(nameKey);
+	if (index >= 0) {
+		return m_namedObjects[index].second;
 	}
 	return NULL;
 }
@@ -5301,14 +5473,98 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == NULL);
-		}
+	const Int index = findNamedObject(unitName);
+	if (index >= 0) {
+		return (m_namedObjects[index].second == NULL);
 	}
 	return false;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Same as above, with the name key the parameter is bound to. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::didUnitExist(Parameter *pUnitParm)
+{
+	const NameKeyType nameKey = getBoundNameKey(pUnitParm);
+	if (nameKey == NAMEKEY_INVALID) {
+		return didUnitExist(pUnitParm->getString());
+	}
+
+	const Int index = findNamedObject(nameKey);
+	if (index >= 0) {
+		return (m_namedObjects[index].second == NULL);
+	}
+	return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Binds the parameters of the conditions of the script. The actions run once each time a script
+fires and take the names themselves, so they keep looking them up. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::bindConditionParameters(Script *pScript)
+{
+	for (OrCondition *pOr = pScript->getOrCondition(); pOr; pOr = pOr->getNextOrCondition()) {
+		for (Condition *pCond = pOr->getFirstAndCondition(); pCond; pCond = pCond->getNext()) {
+			for (Int i = 0; i < pCond->getNumParameters(); i++) {
+				bindParameter(pCond->getParameter(i));
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Binds a unit, team or bridge parameter to the name key of its name, a trigger area parameter to
+its trigger area and an object type parameter to its object type list. The names that stand for the
+calling team, object or player are left unbound, like the names that no object has had yet. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::bindParameter(Parameter *pParm)
+{
+	if (pParm == NULL) {
+		return;
+	}
+
+	const AsciiString& name = pParm->getString();
+	NameKeyType nameKey = NAMEKEY_INVALID;
+	PolygonTrigger *triggerArea = NULL;
+	ObjectTypes *objectTypes = NULL;
+	switch (pParm->getParameterType()) {
+		case Parameter::UNIT:
+		case Parameter::BRIDGE:
+			if (name != THIS_OBJECT) {
+				nameKey = TheNameKeyGenerator->findNameKey(name);
+			}
+			break;
+		case Parameter::TEAM:
+			if (name != THIS_TEAM) {
+				nameKey = TheNameKeyGenerator->findNameKey(name);
+			}
+			break;
+		case Parameter::TRIGGER_AREA:
+			if (name != MY_INNER_PERIMETER && name != MY_OUTER_PERIMETER &&
+					name != ENEMY_INNER_PERIMETER && name != ENEMY_OUTER_PERIMETER) {
+				triggerArea = TheTerrainLogic->getTriggerAreaByName(name);
+			}
+			break;
+		case Parameter::OBJECT_TYPE:
+			objectTypes = getObjectTypes(name);
+			break;
+		default:
+			break;
+	}
+	pParm->friend_bind(m_parameterGeneration, nameKey, triggerArea, objectTypes);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the name key the parameter is bound to, binding it first if it is not bound to this map. */
+//-------------------------------------------------------------------------------------------------
+NameKeyType ScriptEngine::getBoundNameKey(Parameter *pParm)
+{
+	if (pParm->friend_getBindingGeneration() != m_parameterGeneration) {
+		bindParameter(pParm);
+	}
+	return pParm->getNameKey();
+}
+
 //-------------------------------------------------------------------------------------------------
 /** runScript - Executes a subroutine script, or script group - tests conditions, and executes actions or false actions.  */
 //-------------------------------------------------------------------------------------------------
@@ -5653,6 +5909,7 @@ void ScriptEngine::setCounter( ScriptAction *pAction )
 	}
 	Int value = pAction->getParameter(1)->getInt();
 	m_counters[counterNdx].value = value;
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5721,6 +5978,7 @@ void ScriptEngine::addCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value += value;
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5736,6 +5994,7 @@ void ScriptEngine::subCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value -= value;
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5780,6 +6039,7 @@ void ScriptEngine::setFlag( ScriptAction *pAction )
 	}
 	Bool value = pAction->getParameter(1)->getInt();
 	m_flags[flagNdx].value = value;
+	noteFlagChanged(flagNdx);
 }
 
 
@@ -5993,6 +6253,7 @@ void ScriptEngine::removeObjectTypes(ObjectTypes *typesToRemove)
 
 	// remove it from the main array of stuff
 	m_allObjectTypeLists.erase(it);
+	++m_parameterGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6042,6 +6303,7 @@ void ScriptEngine::setTimer( ScriptAction *pAction, Bool millisecondTimer, Bool
 		m_counters[counterNdx].value = value;
 	}
 	m_counters[counterNdx].isCountdownTimer = true;
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6056,6 +6318,7 @@ void ScriptEngine::pauseTimer( ScriptAction *pAction )
 		pAction->getParameter(0)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].isCountdownTimer = false;
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6071,6 +6334,7 @@ void ScriptEngine::restartTimer( ScriptAction *pAction )
 	}
 	if (m_counters[counterNdx].value > 0) {
 		m_counters[counterNdx].isCountdownTimer = true;
+		noteCounterChanged(counterNdx);
 	}
 }
 
@@ -6096,6 +6360,7 @@ void ScriptEngine::adjustTimer( ScriptAction *pAction, Bool millisecondTimer, Bo
 			value = -value;
 		m_counters[counterNdx].value += value;
 	}
+	noteCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6257,6 +6522,9 @@ void ScriptEngine::executeScript( Script *pScript )
 	if (delaySeconds>0) {
 		pScript->setFrameToEvaluate(TheGameLogic->getFrame()+delaySeconds*LOGICFRAMES_PER_SECOND);
 	}
+	if (isScriptSleeping(pScript)) {
+		return;
+	}
 #ifdef DEBUG_LOGGING
 #ifdef SPECIAL_SCRIPT_PROFILING
 	__int64 startTime64;
@@ -6270,6 +6538,13 @@ void ScriptEngine::executeScript( Script *pScript )
 	Team *pSavConditionTeam = m_conditionTeam;
 	TeamPrototype *pProto = NULL;
 
+	// Record what the conditions read, so the script can sleep if they are false.
+	std::vector<const UnsignedInt *> *dependencies = pScript->friend_getConditionDependencies();
+	dependencies->clear();
+	LatchRestore<std::vector<const UnsignedInt *> *> latchDependencies(m_conditionDependencies, dependencies);
+	LatchRestore<Bool> latchTrackable(m_conditionsTrackable, pScript->getFalseAction() == NULL);
+	Bool anyConditionsTrue = false;
+
 	if (!pScript->getConditionTeamName().isEmpty()) {
 		pProto = TheTeamFactory->findTeamPrototype(pScript->getConditionTeamName());
 	}
@@ -6281,10 +6556,11 @@ void ScriptEngine::executeScript( Script *pScript )
 			m_conditionTeam = iter.cur();
 			// If conditions evaluate to true, execute actions.
 			if (evaluateConditions(pScript)) {
+				anyConditionsTrue = true;
 				// Script Debug window
 				if (pScript->getAction()) {
 					_appendMessage(pScript->getName());
-					executeActions(pScript->getAction());
+					executeScriptActions(pScript, pScript->getAction());
 				}
 				
 				if (pScript->isOneShot()) {
@@ -6296,7 +6572,7 @@ void ScriptEngine::executeScript( Script *pScript )
 				_appendMessage(pScript->getName(), false);
 
 				// Only do this is there are actually false actions.
-				executeActions(pScript->getFalseAction());
+				executeScriptActions(pScript, pScript->getFalseAction());
 			}
 		}
 
@@ -6304,10 +6580,11 @@ void ScriptEngine::executeScript( Script *pScript )
 		m_conditionTeam = NULL;
 		// If conditions evaluate to true, execute actions.
 		if (evaluateConditions(pScript)) {
+			anyConditionsTrue = true;
 			if (pScript->getAction()) {
 				// Script Debug window
 				_appendMessage(pScript->getName());
-				executeActions(pScript->getAction());
+				executeScriptActions(pScript, pScript->getAction());
 			}
 
 			if (pScript->isOneShot()) {
@@ -6319,7 +6596,7 @@ void ScriptEngine::executeScript( Script *pScript )
 			_appendMessage(pScript->getName(), false);
 
 			// Only do this is there are actually false actions.
-			executeActions(pScript->getFalseAction());
+			executeScriptActions(pScript, pScript->getFalseAction());
 			if (pScript->isOneShot()) {
 				pScript->setActive(false);
 			}
@@ -6333,6 +6610,7 @@ void ScriptEngine::executeScript( Script *pScript )
 #endif
 #endif
 
+	pScript->friend_setConditionSleepSerial((m_conditionsTrackable && !anyConditionsTrue) ? m_conditionChangeSerial : 0);
 	m_conditionTeam = pSavConditionTeam;
 }
 
@@ -6341,21 +6619,90 @@ void ScriptEngine::executeScript( Script *pScript )
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 {
+	Bool value;
 	switch (pCondition->getConditionType()) {
 		default: 
-			return TheScriptConditions->evaluateCondition(pCondition);
-		case Condition::CONDITION_FALSE: return false;
-		case Condition::CONDITION_TRUE: return true;
-		case Condition::COUNTER: return evaluateCounter(pCondition);
-		case Condition::FLAG: return evaluateFlag(pCondition);
-		case Condition::TIMER_EXPIRED: return evaluateTimer(pCondition);
+			value = TheScriptConditions->evaluateCondition(pCondition); break;
+		case Condition::CONDITION_FALSE: value = false; break;
+		case Condition::CONDITION_TRUE: value = true; break;
+		case Condition::COUNTER: value = evaluateCounter(pCondition); break;
+		case Condition::FLAG: value = evaluateFlag(pCondition); break;
+		case Condition::TIMER_EXPIRED: value = evaluateTimer(pCondition); break;
+	}
+	if (m_conditionDependencies && m_conditionsTrackable) {
+		recordConditionDependencies(pCondition);
+	}
+	return value;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Records the change serials of the state that the condition just read, or that it can't be tracked. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::recordConditionDependencies( Condition *pCondition )
+{
+	switch (pCondition->getConditionType()) {
+		default:
+			// Reads state that changes without telling the script engine.
+			m_conditionsTrackable = false;
+			break;
+		case Condition::CONDITION_FALSE:
+		case Condition::CONDITION_TRUE:
+			break;
+		case Condition::COUNTER:
+		case Condition::TIMER_EXPIRED:
+			m_conditionDependencies->push_back(&m_counters[pCondition->getParameter(0)->getInt()].changeSerial);
+			break;
+		case Condition::FLAG:
+			m_conditionDependencies->push_back(&m_flags[pCondition->getParameter(0)->getInt()].changeSerial);
+			m_conditionDependencies->push_back(&m_uiInteractionsChangeSerial);
+			break;
+		case Condition::NAMED_DESTROYED:
+		case Condition::NAMED_DYING:
+		case Condition::NAMED_TOTALLY_DEAD:
+		case Condition::NAMED_NOT_DESTROYED:
+			// <This Object> depends on the calling object, the other names only on the named objects.
+			if (pCondition->getParameter(0)->getString() == THIS_OBJECT) {
+				m_conditionsTrackable = false;
+			} else {
+				m_conditionDependencies->push_back(&m_namedObjectsChangeSerial);
+			}
+			break;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns true if the conditions of the script were false, and nothing they read changed since. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::isScriptSleeping( Script *pScript ) const
+{
+	const UnsignedInt sleepSerial = pScript->friend_getConditionSleepSerial();
+	if (sleepSerial <= m_conditionWakeSerial) {
+		return false;
+	}
+
+	const std::vector<const UnsignedInt *> *dependencies = pScript->friend_getConditionDependencies();
+	for (size_t i = 0; i < dependencies->size(); ++i) {
+		if (*(*dependencies)[i] > sleepSerial) {
+			return false;
+		}
 	}
+	return true;
 }
 
 //-------------------------------------------------------------------------------------------------
-/** Execute an action specified by pActionHead */
+/** Execute the actions or the false actions of a map script */
 //-------------------------------------------------------------------------------------------------
-void ScriptEngine::friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam )
+void ScriptEngine::executeScriptActions( Script *pScript, ScriptAction *pActionHead )
+{
+	SCRIPT_PROFILE_SCOPE(actions, pScript, "Map", pScript->getName(), ScriptProfiler::PHASE_ACTIONS);
+	executeActions(pActionHead);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Execute an action specified by pActionHead. pScript, if given, is the script the actions 
+		belong to, and is only used to profile them. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam, const Script *pScript )
 {
 	Team *pSavCallingTeam = m_callingTeam;
 	Player *pSavPlayer = m_currentPlayer;
@@ -6364,7 +6711,12 @@ void ScriptEngine::friend_executeAction( ScriptAction *pActionHead, Team *pThisT
 	if (pThisTeam) {
 		m_currentPlayer = pThisTeam->getControllingPlayer();
 	}
-	executeActions(pActionHead);
+	if (pScript) {
+		SCRIPT_PROFILE_SCOPE(actions, pScript, pThisTeam ? "Team" : "Map", pScript->getName(), ScriptProfiler::PHASE_ACTIONS);
+		executeActions(pActionHead);
+	} else {
+		executeActions(pActionHead);
+	}
 	m_callingTeam = pSavCallingTeam;
 	m_currentPlayer = pSavPlayer;
 }
@@ -6384,35 +6736,34 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (it->first == objName) {
-			if (it->second == NULL) {
-				AsciiString newNameForDead;
-				newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
-				TheScriptEngine->AppendDebugMessage(newNameForDead, FALSE);
-				DEBUG_LOG((newNameForDead.str()));
-				it->second = pNewObject;
-				return;
-			} else {
-				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s'," 
-										 " but object (%d) of type '%s' already has that name",
-										 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(), 
-										 it->second->getID(), it->second->getTemplate()->getName().str()));
-				return;
-			}
-		}
+	// Whichever of the two entries comes first in the list wins, as if the list was searched in order.
+	const Int nameIndex = findNamedObject(objName);
+	const Int objectIndex = findNamedObject(pNewObject);
 
-		if (pNewObject == (it->second)) {
-			it->first = objName;
+	if (nameIndex >= 0 && (objectIndex < 0 || nameIndex <= objectIndex)) {
+		Object *pNamedObject = m_namedObjects[nameIndex].second;
+		if (pNamedObject == NULL) {
+			AsciiString newNameForDead;
+			newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
+			TheScriptEngine->AppendDebugMessage(newNameForDead, FALSE);
+			DEBUG_LOG((newNameForDead.str()));
+			setNamedObjectObject(nameIndex, pNewObject);
+			return;
+		} else {
+			DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s'," 
+									 " but object (%d) of type '%s' already has that name",
+									 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(), 
+									 pNamedObject->getID(), pNamedObject->getTemplate()->getName().str()));
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
+	if (objectIndex >= 0) {
+		setNamedObjectName(objectIndex, objName);
+		return;
+	}
 
-	m_namedObjects.push_back(req);
+	addNamedObject(objName, pNewObject);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6420,11 +6771,9 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (pDeadObject == (it->second)) {
-			it->second = NULL;	// Don't remove it, cause we want to check whether we ever knew a name later
-			break;
-		}
+	const Int index = findNamedObject(pDeadObject);
+	if (index >= 0) {
+		setNamedObjectObject(index, NULL);	// Don't remove it, cause we want to check whether we ever knew a name later
 	}
 }
 
@@ -6453,28 +6802,157 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it's named the name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
+	//Find the string entry in the cached list. If found, change the object
 	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	const Int index = findNamedObject(unitName);
+	if( index >= 0 )
 	{
-		if( !unitName.compare( it->first ) )
+		Object* pOldObj = m_namedObjects[index].second;
+		if( pOldObj )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
-			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
-			}
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
+		}
 
-			it->second = pNewObject;
+		setNamedObjectObject(index, pNewObject);
+	}
 
-			return;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Counts the entry at index in the entry of a name or object of the named object maps. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addToNamedObjectIndex(NamedObjectIndex& entry, Int index)
+{
+	if (entry.count == 0 || index < entry.first)
+		entry.first = index;
+	++entry.count;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the position of the first named object entry with the name, or -1 if there is none.
+	* Every name in the cache has a name key, so a name without one is not looked up further. */
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObject(const AsciiString& unitName)
+{
+	const NameKeyType nameKey = TheNameKeyGenerator->findNameKey(unitName);
+	if (nameKey == NAMEKEY_INVALID)
+		return -1;
+	return findNamedObject(nameKey);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the position of the first named object entry with the name key, or -1 if there is none. */
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObject(NameKeyType nameKey)
+{
+	NamedObjectsByName::const_iterator it = m_namedObjectsByName.find(nameKey);
+	if (it == m_namedObjectsByName.end())
+		return -1;
+	return it->second.first;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the position of the first named object entry with the object, or -1 if there is none. */
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObject(const Object *obj)
+{
+	if (obj == NULL)
+		return -1;
+
+	NamedObjectsByObject::const_iterator it = m_namedObjectsByObject.find(obj);
+	if (it == m_namedObjectsByObject.end())
+		return -1;
+	return it->second.first;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Appends an entry to the named objects. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addNamedObject(const AsciiString& unitName, Object *obj)
+{
+	NamedRequest req;
+	req.first = unitName;
+	req.second = obj;
+	m_namedObjects.push_back(req);
+
+	const Int index = (Int)m_namedObjects.size() - 1;
+	addToNamedObjectIndex(m_namedObjectsByName[NAMEKEY(unitName)], index);
+	if (obj)
+		addToNamedObjectIndex(m_namedObjectsByObject[obj], index);
+	noteNamedObjectsChanged();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Changes the name of the named object entry at index. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::setNamedObjectName(Int index, const AsciiString& unitName)
+{
+	NamedRequest& req = m_namedObjects[index];
+
+	NamedObjectsByName::iterator it = m_namedObjectsByName.find(NAMEKEY(req.first));
+	DEBUG_ASSERTCRASH(it != m_namedObjectsByName.end(), ("ScriptEngine - named object '%s' is not in the name map", req.first.str()));
+	if (--it->second.count == 0)
+	{
+		m_namedObjectsByName.erase(it);
+	}
+	else if (it->second.first == index)
+	{
+		// the other entries with this name all come after this one
+		Int next = index + 1;
+		while (m_namedObjects[next].first != req.first)
+			++next;
+		it->second.first = next;
+	}
+
+	req.first = unitName;
+	addToNamedObjectIndex(m_namedObjectsByName[NAMEKEY(unitName)], index);
+	noteNamedObjectsChanged();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Changes the object of the named object entry at index. The object may be NULL. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::setNamedObjectObject(Int index, Object *obj)
+{
+	NamedRequest& req = m_namedObjects[index];
+
+	if (req.second)
+	{
+		NamedObjectsByObject::iterator it = m_namedObjectsByObject.find(req.second);
+		DEBUG_ASSERTCRASH(it != m_namedObjectsByObject.end(), ("ScriptEngine - named object '%s' is not in the object map", req.first.str()));
+		if (--it->second.count == 0)
+		{
+			m_namedObjectsByObject.erase(it);
+		}
+		else if (it->second.first == index)
+		{
+			// the other entries with this object all come after this one
+			Int next = index + 1;
+			while (m_namedObjects[next].second != req.second)
+				++next;
+			it->second.first = next;
 		}
 	}
 
+	req.second = obj;
+	if (obj)
+		addToNamedObjectIndex(m_namedObjectsByObject[obj], index);
+	noteNamedObjectsChanged();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Removes all named objects. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::clearNamedObjects()
+{
+	m_namedObjects.clear();
+	m_namedObjectsByName.clear();
+	m_namedObjectsByObject.clear();
+	noteNamedObjectsChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6495,6 +6973,16 @@ void ScriptEngine::notifyOfObjectDestruction( Object *pDeadObject )
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Wakes the scripts that wait on a named object, when one of them dies or comes back to life. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::notifyOfObjectDeathChange( Object *pObject )
+{
+	if (findNamedObject(pObject) >= 0) {
+		noteNamedObjectsChanged();
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Notify the script engine that a video has completed */
 //-------------------------------------------------------------------------------------------------
@@ -6549,6 +7037,7 @@ void ScriptEngine::notifyOfAcquiredScience( Int playerIndex, ScienceType science
 void ScriptEngine::signalUIInteract(const AsciiString& hookName)
 {
 	m_uiInteractions.push_front(hookName);
+	noteUIInteractionsChanged();
 #ifdef DEBUG_LOGGING
 	AppendDebugMessage(hookName, false); // don't bother in Release
 #endif
@@ -6864,6 +7353,8 @@ void ScriptEngine::adjustToppleDirection( Object *object, Coord3D *direction)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *player )
 {
+	// Team scripts pass their team and the AI passes its player, map scripts pass neither.
+	SCRIPT_PROFILE_SCOPE(conditions, pScript, thisTeam ? "Team" : (player ? "AI" : "Map"), pScript->getName(), ScriptProfiler::PHASE_CONDITIONS);
 	LatchRestore<Team*> latch(m_callingTeam, thisTeam);
 	if (thisTeam) player = thisTeam->getControllingPlayer();
 	if (player==NULL) player=m_currentPlayer;
@@ -6999,7 +7490,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::createNamedCache( void )
 {
-	m_namedObjects.clear();
+	clearNamedObjects();
 
 	if( !TheGameLogic )
 	{
@@ -7009,10 +7500,7 @@ void ScriptEngine::createNamedCache( void )
 
 	while (pObj) {
 		if (!pObj->getName().isEmpty()) {
-			NamedRequest req;
-			req.first = pObj->getName();
-			req.second = pObj;
-			m_namedObjects.push_back(req);
+			addNamedObject(pObj->getName(), pObj);
 		}
 		pObj = pObj->getNextObject();
 	}
@@ -8286,13 +8774,12 @@ void ScriptEngine::xfer( Xfer *xfer )
 	}  // end if, save
 	else
 	{
-		NamedRequest req;
 
 		//
 		// list should be empty, it is legal for it to not be empty at this point
 		// according to John M., so we're clearing it now
 		//
-		m_namedObjects.clear();
+		clearNamedObjects();
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -8313,9 +8800,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 			}  // end if
 
 			// assign
-			req.first = namedObjectName;
-			req.second = obj;
-			m_namedObjects.push_back( req );
+			addNamedObject( namedObjectName, obj );
 
 		}  // end for, i
 
@@ -8563,6 +9048,9 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 			}  // end for, i
 
+			// The parameters may still be bound to the lists of the game before the load.
+			++m_parameterGeneration;
+
 		}  //  end else, load
 
 	}  // end if, version 2
@@ -8607,6 +9095,8 @@ void ScriptEngine::xfer( Xfer *xfer )
 // ------------------------------------------------------------------------------------------------
 void ScriptEngine::loadPostProcess( void )
 {
+	// The loaded counters, flags and objects don't carry change serials.
+	wakeAllScripts();
 
 	// Now that we've loaded everything, go through and set them all back in sync with what we
 	// currently think they should be.
@@ -51,6 +51,7 @@ static void drawFramerateBar(void);
 #include "Common/ThingTemplate.h"
 #include "Common/GameLOD.h"
 #include "Common/DrawModule.h"
+#include "GameLogic/AI.h"
 #include "GameLogic/AIPathfind.h"
 
 #include "GameClient/Drawable.h"
@@ -226,6 +227,13 @@ void StatDumpClass::dumpStats()
 	fprintf( m_fp, "    -attacking: %d\n", numAttacking );
 	fprintf( m_fp, "    -waiting for path: %d\n", numWaitingForPath );
 	fprintf( m_fp, "  Total failed pathfinds: %d\n", overallFailedPathfinds );
+	PathfindQueueStats pathfindQueueStats;
+	TheAI->pathfinder()->getQueueStats( pathfindQueueStats );
+	fprintf( m_fp, "  Pathfind queue depth: %d (player %d, AI %d, repath %d)\n", pathfindQueueStats.queueDepth,
+		pathfindQueueStats.queueDepthByPriority[PATHFIND_PRIORITY_PLAYER], pathfindQueueStats.queueDepthByPriority[PATHFIND_PRIORITY_AI],
+		pathfindQueueStats.queueDepthByPriority[PATHFIND_PRIORITY_REPATH] );
+	fprintf( m_fp, "    -paths last frame: %d (%d shared)\n", pathfindQueueStats.pathsLastFrame, pathfindQueueStats.sharedPathsLastFrame );
+	fprintf( m_fp, "    -queue latency last frame: %.1f avg, %d max frames\n", pathfindQueueStats.avgLatencyLastFrame, pathfindQueueStats.maxLatencyLastFrame );
 	fprintf( m_fp, "\n" );
 
 	// Script stats
@@ -241,11 +249,12 @@ void StatDumpClass::dumpStats()
 
 
 	//PartitionMgr stats
-	double gcoTimeThisFrameTotal, gcoTimeThisFrameAvg;
-	ThePartitionManager->getPMStats(gcoTimeThisFrameTotal, gcoTimeThisFrameAvg);
+	double gcoTimeThisFrameTotal, gcoTimeThisFrameAvg, gcoCacheHitRate;
+	ThePartitionManager->getPMStats(gcoTimeThisFrameTotal, gcoTimeThisFrameAvg, gcoCacheHitRate);
 	fprintf(m_fp, "Partition Manager Statistics:\n");
 	fprintf(m_fp, "  Total time for object scans this frame is %.5f msec\n", gcoTimeThisFrameTotal);
 	fprintf(m_fp, "  Avg time per object scan this frame is %.5f msec\n", gcoTimeThisFrameAvg);
+	fprintf(m_fp, "  Object scan cache hit rate last frame is %.1f%%\n", gcoCacheHitRate * 100.0);
 	fprintf( m_fp, "\n" );
 
 	// setup texture stats
@@ -62,6 +62,16 @@
 	#define MEMORYPOOL_DEBUG
 #endif
 
+// TheSuperHackers @performance alanblack166 18/10/2026 Each thread keeps a small cache of free blocks for every pool that may
+// grow, and only takes the memory pool lock to move a batch of blocks between its cache and the blobs.
+// The debug builds track every block under the lock, so they do not use the caches.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(MEMORYPOOL_THREAD_CACHE) && !defined(DISABLE_MEMORYPOOL_THREAD_CACHE)
+	#define MEMORYPOOL_THREAD_CACHE
+#endif
+#if defined(MEMORYPOOL_DEBUG) && defined(MEMORYPOOL_THREAD_CACHE)
+	#error the memory pool thread caches do not work with MEMORYPOOL_DEBUG
+#endif
+
 // SYSTEM INCLUDES ////////////////////////////////////////////////////////////
 
 #include <new.h>
@@ -226,6 +236,7 @@ class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
+struct MemoryPoolThreadCacheEntry;
 
 // TYPE DEFINES ///////////////////////////////////////////////////////////////
 
@@ -309,6 +320,12 @@ private:
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+	Int								m_contendedLocks;						///< number of times a thread had to wait for the lock of this pool
+	Int								m_threadCacheIndex;					///< slot of this pool in the thread caches, or -1 if it is not cached
+	Int								m_threadCacheBatchCount;		///< number of blocks that move between a thread cache and the blobs at once
+	Int								m_threadCacheGeneration;		///< changes when the pool is reset, so the threads drop their cached blocks
+	Int								m_threadCacheRefills;				///< number of batches taken from the blobs by the thread caches
+	Int								m_threadCacheFlushes;				///< number of batches given back to the blobs by the thread caches
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -317,12 +334,23 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// return a blob with free blocks, creating one if allowed. returns null if there is none and mayGrow is false.
+	MemoryPoolBlob* findBlobWithFreeBlocks(Bool mayGrow);
+
+	#ifdef MEMORYPOOL_THREAD_CACHE
+		MemoryPoolThreadCacheEntry *getThreadCacheEntry();
+		void refillThreadCache(MemoryPoolThreadCacheEntry *entry);
+		void flushThreadCache(MemoryPoolThreadCacheEntry *entry, Int keepCount);
+	#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
 	MemoryPool *getNextPoolInList();					///< return next pool in linked list
 	void addToList(MemoryPool **pHead);				///< add this pool to head of the linked list
 	void removeFromList(MemoryPool **pHead);	///< remove this pool from the linked list
+	static void poolStatsReport( MemoryPool *pool, FILE *fp );	///< write the sizing and contention statistics of this pool as a CSV line
+	static void releaseThreadCache();	///< give the blocks in the thread cache of the calling thread back to their pools
 	#ifdef MEMORYPOOL_DEBUG
 		static void debugPoolInfoReport( MemoryPool *pool, FILE *fp = NULL );	///< dump a report about this pool to the logfile
 		const char *debugGetBlockTagString(void *pBlock);		///< return the tagstring for the given block (assumed to belong to this pool)
@@ -375,6 +403,12 @@ public:
 	/// return the initial allocation count for this pool
 	Int getInitialBlockCount();
 
+	/// return the number of times a thread had to wait for the lock of this pool
+	Int getContendedLockCount();
+
+	/// return true if the threads keep free blocks of this pool in their caches
+	Bool hasThreadCache();
+
 	Int countBlobsInPool();
 
 	/// if this pool has any empty blobs, return them to the system.
@@ -550,6 +584,9 @@ public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = NULL );
 
+	/// write the peak usage and the lock contention of every pool to a CSV file. works in all builds.
+	void memoryPoolStatsReport( const char* filename );
+
 	#ifdef MEMORYPOOL_DEBUG
 
 		/// perform internal consistency checking
@@ -784,6 +821,8 @@ inline Int MemoryPool::getUsedBlockCount() { return m_usedBlocksInPool; }
 inline Int MemoryPool::getTotalBlockCount() { return m_totalBlocksInPool; }
 inline Int MemoryPool::getPeakBlockCount() { return m_peakUsedBlocksInPool; }
 inline Int MemoryPool::getInitialBlockCount() { return m_initialAllocationCount; }
+inline Int MemoryPool::getContendedLockCount() { return m_contendedLocks; }
+inline Bool MemoryPool::hasThreadCache() { return m_threadCacheIndex >= 0; }
 
 // ----------------------------------------------------------------------------
 inline DynamicMemoryAllocator *DynamicMemoryAllocator::getNextDmaInList() { return m_nextDmaInFactory; }
@@ -797,6 +836,12 @@ inline DynamicMemoryAllocator *DynamicMemoryAllocator::getNextDmaInList() { retu
 */
 extern void initMemoryManager();
 
+/**
+	Give the free blocks that the calling thread keeps in its pool caches back to the pools.
+	Threads that allocate from the pools should call this before they exit.
+*/
+extern void releaseMemoryPoolThreadCache();
+
 /**
 	return true if initMemoryManager() has been called.
 	return false if only preMainInitMemoryManager() has been called.
@@ -65,6 +65,7 @@ class MemoryPoolFactory
 public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = NULL );
+	void memoryPoolStatsReport( const char* filename );
 
 #ifdef MEMORYPOOL_DEBUG
 
@@ -127,6 +128,11 @@ inline void deleteInstance(MemoryPoolObject* mpo)
 */
 extern void initMemoryManager();
 
+/**
+	Give the free blocks that the calling thread keeps in its pool caches back to the pools.
+*/
+extern void releaseMemoryPoolThreadCache();
+
 /**
 	return true if initMemoryManager() has been called.
 	return false if only preMainInitMemoryManager() has been called.
@@ -169,6 +169,8 @@ public:
 										 SnapshotType which = SNAPSHOT_SAVELOAD  );  ///< save a game
 	SaveCode missionSave( void );																	 ///< do a in between mission save
 	SaveCode loadGame( AvailableGameInfo gameInfo );							 ///< load a save file
+	SaveCode saveGameToBuffer( std::vector<UnsignedByte> &buffer );			 ///< save the game state to memory
+	SaveCode loadGameFromBuffer( const std::vector<UnsignedByte> &buffer ); ///< load the game state from memory
 	SaveGameInfo *getSaveGameInfo( void ) { return &m_gameInfo; }
 
 	// snapshot interaction
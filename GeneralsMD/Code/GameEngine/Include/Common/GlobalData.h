@@ -355,6 +355,21 @@ public:
 	
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	Int m_simulateReplaysPerJob; ///< Number of replays simulated by each worker process before it exits
+	AsciiString m_simulateReplaySummary; ///< If not empty, write a replay simulation summary to this file
+	UnsignedInt m_simulateReplayCheckpointInterval; ///< Logic frames between replay checkpoints during simulation, or 0 if disabled
+	AsciiString m_simulateReplayProfile; ///< If not empty, write a logic profile of the simulated replays to this file (.csv or .json)
+	Bool m_benchmarkArchives; ///< If true, open every file in the archive files, print the timings and exit
+	Bool m_benchmarkCRC; ///< If true, measure the throughput of the CRC kernels, print it and exit
+	Bool m_benchmarkParticles; ///< If true, update and look up many particle systems without a map, print the timings and exit
+	Bool m_benchmarkPartitionDistances; ///< If true, compare the batched and the scalar distance checks of the partition manager, print the timings and exit
+	Int m_benchmarkScriptFrames; ///< If above 0, time ScriptEngine::update for this many logic frames of the map in m_initialFile, print the timings and exit
+	Bool m_useINICache; ///< If true, replay unchanged INI files from the binary INI cache in the user data folder
+	Bool m_useINIPrefetch; ///< If true, split the INI files of the startup into lines on worker threads
+	AsciiString m_startupTimelineFile; ///< If not empty, write the startup timeline to this file (.csv)
+	Int m_saveGameCompression; ///< CompressionType of save game files, which are then written on a background thread
+	AsciiString m_poolStatsFile; ///< If not empty, write the peak usage and lock contention of the memory pools to this file (.csv) at exit
+	AsciiString m_scriptProfileFile; ///< If not empty, write the time spent in every script to this file (.csv) at the end of every game
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
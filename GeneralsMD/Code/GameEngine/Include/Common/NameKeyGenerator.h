@@ -38,6 +38,8 @@
 #include "Common/GameMemory.h"
 #include "Common/AsciiString.h"
 
+class CriticalSection;
+
 //------------------------------------------------------------------------------------------------- 
 /**
 	Note that NameKeyType isn't a "real" enum, but an enum type used to enforce the
@@ -66,7 +68,7 @@ public:
 	Bucket();
 //~Bucket();
 
-	Bucket				*m_nextInSocket;
+	Bucket * volatile m_nextInSocket;
 	NameKeyType		m_key;
 	AsciiString		m_nameString;
 };
@@ -80,7 +82,12 @@ inline Bucket::~Bucket() { }
 	* guaranteed to return the same key. Also, all keys generated by an 
 	* instance of this class are guaranteed to be unique with respect to that 
 	* instance's catalog of names.  Multiple instances of this class can be 
-	* created to service multiple namespaces. */
+	* created to service multiple namespaces.
+	*
+	* TheSuperHackers @performance alanblack166 18/10/2026 Lookups do not lock and may run on any thread. Adding a name
+	* takes a lock, and a new bucket is fully set up before it is linked, so a lookup sees either
+	* no bucket or a complete one. Keys are handed out in the order names are first seen, so names
+	* that end up in game logic or in save files must still be added in a fixed order. */
 //------------------------------------------------------------------------------------------------- 
 class NameKeyGenerator : public SubsystemInterface
 {
@@ -99,16 +106,25 @@ public:
 	NameKeyType nameToLowercaseKey(const AsciiString& name) { return nameToLowercaseKey(name.str()); }
 
 	/// Given a string, convert into a unique integer key.
-	NameKeyType nameToKey(const char* name);
+	NameKeyType nameToKey(const char* name) { return nameToKey(name, calcHashForString(name)); }
 	NameKeyType nameToLowercaseKey(const char *name);
 
+	/// Same as nameToKey, with the hash of the name already calculated by calcHashForString.
+	NameKeyType nameToKey(const char* name, UnsignedInt hash);
+
+	/// Like nameToKey, but returns NAMEKEY_INVALID for a name that has no key yet instead of adding it.
+	NameKeyType findNameKey(const AsciiString& name) const { return findNameKey(name.str()); }
+	NameKeyType findNameKey(const char* name) const;
+
 	/** 
 		given a key, return the name. this is almost never needed,
-		except for a few rare cases like object serialization. also
-		note that it's not particularly fast; it does a dumb linear
-		search for the key.
+		except for a few rare cases like object serialization.
+		Returns the empty string for unknown keys.
 	*/
-	AsciiString keyToName(NameKeyType key);
+	const AsciiString& keyToName(NameKeyType key) const;
+
+	static UnsignedInt calcHashForString(const char* p);
+	static UnsignedInt calcHashForLowercaseString(const char* p);
 
   // Get a string out of the INI. Store it into a NameKeyType
   static void parseStringAsNameKeyType( INI *ini, void *instance, void *store, const void* userData );
@@ -121,10 +137,24 @@ private:
 		SOCKET_COUNT = 45007
 	};
 
+	enum
+	{
+		// keys are mapped back to their buckets through pages of this many entries, allocated on demand.
+		KEY_PAGE_SIZE = 4096,
+		KEY_PAGE_COUNT = NAMEKEY_MAX / KEY_PAGE_SIZE
+	};
+
+	typedef Bucket * volatile *KeyPage;
+
 	void freeSockets();
+	Bucket* findBucket(const char* name, UnsignedInt socket, Bool ignoreCase) const;
+	NameKeyType addName(const char* name, UnsignedInt socket, Bool ignoreCase);
+	void checkSocketDepth() const;
 
-	Bucket*				m_sockets[SOCKET_COUNT];			///< Catalog of all Buckets already generated
+	Bucket * volatile			m_sockets[SOCKET_COUNT];			///< Catalog of all Buckets already generated
+	KeyPage volatile		m_keyPages[KEY_PAGE_COUNT];		///< Buckets by key, for keyToName
 	UnsignedInt		m_nextID;											///< Next available ID
+	CriticalSection*	m_addNameCriticalSection;			///< Serializes adding names, lookups do not take it
 
 };  // end class NameKeyGenerator
 
@@ -137,7 +167,7 @@ extern NameKeyGenerator *TheNameKeyGenerator;  ///< just one namespace for now
 inline NameKeyType NAMEKEY(const AsciiString& name) { return TheNameKeyGenerator->nameToKey(name); }
 inline NameKeyType NAMEKEY(const char* name) { return TheNameKeyGenerator->nameToKey(name); }
 
-inline AsciiString KEYNAME(NameKeyType nk) { return TheNameKeyGenerator->keyToName(nk); }
+inline const AsciiString& KEYNAME(NameKeyType nk) { return TheNameKeyGenerator->keyToName(nk); }
 
 //------------------------------------------------------------------------------------------------- 
 class StaticNameKey
@@ -145,8 +175,9 @@ class StaticNameKey
 private:
 	mutable NameKeyType m_key;
 	const char* m_name;
+	UnsignedInt m_hash;	///< hash of m_name, calculated up front so that key() only has to look it up
 public:
-	StaticNameKey(const char* p) : m_key(NAMEKEY_INVALID), m_name(p) {}
+	StaticNameKey(const char* p) : m_key(NAMEKEY_INVALID), m_name(p), m_hash(NameKeyGenerator::calcHashForString(p)) {}
 	NameKeyType key() const;
 	// ugh, this is a little hokey, but lets us pretend that a StaticNameKey == NameKeyType
 	inline operator NameKeyType() const { return key(); }
@@ -53,6 +53,7 @@ enum RecorderModeType CPP_11(: Int) {
 };
 
 class CRCInfo;
+class ReplayCheckpoint;
 
 class RecorderClass : public SubsystemInterface {
 public:
@@ -83,6 +84,14 @@ public:
 #endif
 	Bool isPlaybackInProgress() const;
 
+	// TheSuperHackers @feature alanblack166 18/10/2026 Replay checkpoints. During replay simulation the game state is saved
+	// every N logic frames into a ring buffer of the last M checkpoints. The playback can then resume
+	// from any of them, for example to investigate a CRC mismatch without replaying the whole game.
+	void setCheckpointInterval(UnsignedInt frameInterval, UnsignedInt maxCheckpoints); ///< 0 frames disables checkpoints
+	void updateCheckpoints();													///< Call before each logic update to take due checkpoints.
+	Bool restoreCheckpoint(UnsignedInt frame);				///< Resume playback from the latest checkpoint at or before frame.
+	UnsignedInt getCheckpointFrame(UnsignedInt frame) const; ///< Frame of the latest checkpoint at or before frame, or 0 if there is none.
+
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
 protected:
@@ -129,6 +138,7 @@ public:
 	void logPlayerDisconnect(UnicodeString player, Int slot);
 	void logCRCMismatch( void );
 	Bool sawCRCMismatch() const;
+	UnsignedInt getCRCMismatchFrame() const { return m_crcMismatchFrame; } ///< Frame of the first CRC mismatch in playback
 	void cleanUpReplayFile( void );										///< after a crash, send replay/debug info to a central repository
 
 	void stopRecording();															///< Stop recording and close m_file.
@@ -154,6 +164,9 @@ protected:
 
 	CullBadCommandsResult cullBadCommands(); ///< prevent the user from giving mouse commands that he shouldn't be able to do during playback.
 
+	const ReplayCheckpoint *findCheckpoint(UnsignedInt frame) const;
+	void clearCheckpoints();
+
 	FILE *m_file;
 	AsciiString m_fileName;
 	Int m_currentFilePosition;
@@ -169,6 +182,13 @@ protected:
 	Int m_originalGameMode; // valid in replays
 
 	UnsignedInt m_nextFrame;												///< The Frame that the next message is to be executed on.  This can be -1.
+	UnsignedInt m_crcMismatchFrame;									///< The Frame of the first CRC mismatch in playback, or 0.
+
+	std::vector<ReplayCheckpoint*> m_checkpoints;		///< Ring buffer of replay checkpoints
+	UnsignedInt m_checkpointInterval;								///< Logic frames between checkpoints, or 0 if disabled
+	UnsignedInt m_maxCheckpoints;										///< Capacity of the checkpoint ring buffer
+	UnsignedInt m_nextCheckpointIndex;							///< Slot for the next checkpoint in the ring buffer
+	Bool m_isRestoringCheckpoint;										///< Keeps the playback state alive while the engine resets
 };
 
 extern RecorderClass *TheRecorder;
@@ -698,6 +698,7 @@ public:
 
 	/// return the TeamPrototype with the given name. if none exists, return null.
 	TeamPrototype *findTeamPrototype(const AsciiString& name);
+	TeamPrototype *findTeamPrototype(NameKeyType nameKey);
 
 	/// return TeamPrototype with matching ID.  if none exists NULL is returned
 	TeamPrototype *findTeamPrototypeByID( TeamPrototypeID id );
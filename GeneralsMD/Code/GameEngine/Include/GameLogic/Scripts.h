@@ -72,6 +72,8 @@
 #define OUTER_PERIMETER "OuterPerimeter"
 
 class Parameter;
+class ObjectTypes;
+class PolygonTrigger;
 class Script;
 class OrCondition;
 class Condition;
@@ -635,6 +637,8 @@ protected:	// Note - If you add any member vars, you must take them into account
 	Real				m_conditionTime;		///< Amount of time (cum) to evaluate conditions.
 	Real				m_curTime;		///< Amount of time (cum) to evaluate conditions.
 	Int					m_conditionExecutedCount; ///< Number of times conditions evaluated.
+	UnsignedInt	m_conditionSleepSerial; ///< Set by ScriptEngine while the conditions are known to be false, else 0.
+	std::vector<const UnsignedInt *> m_conditionDependencies; ///< Change serials of the state the false conditions read.
 
 public:
 	Script();
@@ -656,9 +660,9 @@ public:
 	void setHard(Bool hard) { m_hard = hard;}
 	void setSubroutine(Bool subr) { m_isSubroutine = subr;}
 	void setNextScript(Script *pScr) {m_nextScript = pScr;}
-	void setOrCondition(OrCondition *pCond) {m_condition = pCond;}
+	void setOrCondition(OrCondition *pCond) {m_condition = pCond; m_conditionSleepSerial = 0;}
 	void setAction(ScriptAction *pAction) {m_action = pAction;}
-	void setFalseAction(ScriptAction *pAction) {m_actionFalse = pAction;}
+	void setFalseAction(ScriptAction *pAction) {m_actionFalse = pAction; m_conditionSleepSerial = 0;}
 	void updateFrom(Script *pSrc); ///< Updates this from pSrc.  pSrc IS MODIFIED - it's guts are removed.  jba.
 	void setFrameToEvaluate(UnsignedInt frame) {m_frameToEvaluateAt=frame;}
 	void incrementConditionCount(void) {m_conditionExecutedCount++;}
@@ -704,6 +708,9 @@ public:
 	// Support routines for ScriptEngine - 
 	AsciiString getConditionTeamName(void) {return m_conditionTeamName;}
 	void setConditionTeamName(AsciiString teamName) {m_conditionTeamName = teamName;}
+	UnsignedInt friend_getConditionSleepSerial(void) const {return m_conditionSleepSerial;}
+	void friend_setConditionSleepSerial(UnsignedInt serial) {m_conditionSleepSerial = serial;}
+	std::vector<const UnsignedInt *> *friend_getConditionDependencies(void) {return &m_conditionDependencies;}
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -798,7 +805,11 @@ public:
 		m_initialized(false),
 		m_paramType(type),
 		m_int(val),
-		m_real(0)
+		m_real(0),
+		m_nameKey(NAMEKEY_INVALID),
+		m_triggerArea(NULL),
+		m_objectTypes(NULL),
+		m_bindingGeneration(0)
 	{
 		m_coord.x=0;m_coord.y=0;m_coord.z=0;
 	}
@@ -812,11 +823,19 @@ private:
 	Coord3D				m_coord;
 	ObjectStatusMaskType m_objectStatus;
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The string bound to its name key, trigger area and object type list by
+	// ScriptEngine::bindParameter. The binding is valid while m_bindingGeneration matches the generation of the script engine,
+	// 0 means unbound.
+	NameKeyType		m_nameKey;
+	PolygonTrigger *m_triggerArea;
+	ObjectTypes		*m_objectTypes;
+	UnsignedInt		m_bindingGeneration;
+
 protected:
 	void setInt(Int i) {m_int = i;}
 	void setReal(Real r) {m_real = r;}
 	void setCoord3D(const Coord3D *pLoc);
-	void setString(AsciiString s) {m_string = s;}
+	void setString(AsciiString s) {m_string = s; m_bindingGeneration = 0;}
 	void setStatus( ObjectStatusMaskType objectStatus ) { m_objectStatus.set( objectStatus ); }
 
 public:
@@ -829,7 +848,13 @@ public:
 	void friend_setInt(Int i) {m_int = i;}
 	void friend_setReal(Real r) {m_real = r;}
 	void friend_setCoord3D(const Coord3D *pLoc) { setCoord3D(pLoc); }
-	void friend_setString(AsciiString s) {m_string = s;}
+	void friend_setString(AsciiString s) {m_string = s; m_bindingGeneration = 0;}
+
+	UnsignedInt friend_getBindingGeneration(void) const {return m_bindingGeneration;}
+	void friend_bind(UnsignedInt generation, NameKeyType nameKey, PolygonTrigger *triggerArea, ObjectTypes *objectTypes) {m_bindingGeneration = generation; m_nameKey = nameKey; m_triggerArea = triggerArea; m_objectTypes = objectTypes;}
+	NameKeyType getNameKey(void) const {return m_nameKey;} ///< Only valid when bound, see ScriptEngine::bindParameter
+	PolygonTrigger *getTriggerArea(void) const {return m_triggerArea;} ///< Only valid when bound, see ScriptEngine::bindParameter
+	ObjectTypes *getObjectTypes(void) const {return m_objectTypes;} ///< Only valid when bound, see ScriptEngine::bindParameter
 
 	void qualify(const AsciiString& qualifier,const AsciiString& playerTemplateName,const AsciiString& newPlayerName);
 
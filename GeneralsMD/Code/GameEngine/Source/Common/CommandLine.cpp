@@ -36,6 +36,7 @@
 #include "GameClient/GameText.h"
 #include "GameNetwork/NetworkDefs.h"
 #include "trim.h"
+#include "Compression.h"
 
 
 
@@ -449,6 +450,177 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseReplaysPerJob(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaysPerJob = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaysPerJob < 1)
+		{
+			printf("Invalid number of replays per job: %d\n", TheGlobalData->m_simulateReplaysPerJob);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySummary(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySummary = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayCheckpoints(char *args[], int num)
+{
+	if (num > 1)
+	{
+		Int interval = atoi(args[1]);
+		if (interval < 0)
+		{
+			printf("Invalid replay checkpoint interval: %d\n", interval);
+			exit(1);
+		}
+		TheWritableGlobalData->m_simulateReplayCheckpointInterval = interval;
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayProfile(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplayProfile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseBenchmarkArchives(char *args[], int num)
+{
+	TheWritableGlobalData->m_benchmarkArchives = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
+Int parseBenchmarkCRC(char *args[], int num)
+{
+	TheWritableGlobalData->m_benchmarkCRC = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
+Int parseBenchmarkParticles(char *args[], int num)
+{
+	TheWritableGlobalData->m_benchmarkParticles = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
+Int parseBenchmarkPartitionDistances(char *args[], int num)
+{
+	TheWritableGlobalData->m_benchmarkPartitionDistances = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
+Int parseBenchmarkScripts(char *args[], int num)
+{
+	if (num > 2)
+	{
+		TheWritableGlobalData->m_initialFile = args[1];
+		ConvertShortMapPathToLongMapPath(TheWritableGlobalData->m_initialFile);
+		TheWritableGlobalData->m_benchmarkScriptFrames = max(1, atoi(args[2]));
+		TheWritableGlobalData->m_playIntro = FALSE;
+		TheWritableGlobalData->m_afterIntro = TRUE;
+		TheWritableGlobalData->m_playSizzle = FALSE;
+		TheWritableGlobalData->m_shellMapOn = FALSE;
+		return 3;
+	}
+	return 1;
+}
+
+Int parseINICache(char *args[], int num)
+{
+	TheWritableGlobalData->m_useINICache = TRUE;
+	return 1;
+}
+
+Int parseINIPrefetch(char *args[], int num)
+{
+	TheWritableGlobalData->m_useINIPrefetch = TRUE;
+	return 1;
+}
+
+Int parseStartupTimeline(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_startupTimelineFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseSaveCompression(char *args[], int num)
+{
+	if (num > 1)
+	{
+		if (stricmp(args[1], "refpack") == 0)
+			TheWritableGlobalData->m_saveGameCompression = COMPRESSION_REFPACK;
+		else if (stricmp(args[1], "lzh") == 0)
+			TheWritableGlobalData->m_saveGameCompression = COMPRESSION_NOXLZH;
+		else if (stricmp(args[1], "zlib") == 0)
+			TheWritableGlobalData->m_saveGameCompression = COMPRESSION_ZLIB5;
+		else if (stricmp(args[1], "none") == 0)
+			TheWritableGlobalData->m_saveGameCompression = COMPRESSION_NONE;
+		else
+		{
+			printf("Invalid save compression \"%s\", use refpack, lzh, zlib or none\n", args[1]);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parsePoolStats(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_poolStatsFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseScriptProfile(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_scriptProfileFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1154,6 +1326,73 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Simulate up to N replays in each worker process started with -jobs.
+	// The engine is initialized once per worker process, which saves startup time for large replay sets.
+	{ "-replaysPerJob", parseReplaysPerJob },
+
+	// TheSuperHackers @feature alanblack166 18/10/2026 Write a summary of the replay simulation to the given file.
+	// It contains the throughput (replays/s, logic frames/s) and the result and timing of each replay.
+	{ "-replaySummary", parseReplaySummary },
+
+	// TheSuperHackers @feature alanblack166 18/10/2026 Save a checkpoint of the game state every N logic frames while simulating
+	// replays. On a CRC mismatch, the replay is resumed from the last checkpoint before the mismatch to
+	// check that the mismatch reproduces, without simulating the whole replay again.
+	{ "-replayCheckpoints", parseReplayCheckpoints },
+
+	// TheSuperHackers @feature alanblack166 18/10/2026 Profile the logic frames of the simulated replays and write the time spent
+	// in each update module class and partition manager query per frame to the given file.
+	// Files ending with .json are written in the Chrome trace format, all others as CSV.
+	{ "-replayProfile", parseReplayProfile },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Open every file in the loaded archive files, print how long it took and exit.
+	// This compares the archive file backends.
+	{ "-benchmarkArchives", parseBenchmarkArchives },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Hash a buffer with the original CRC loops and with the CRC kernels,
+	// print the throughput of both and exit. Exits with 1 if the CRC values differ.
+	{ "-benchmarkCRC", parseBenchmarkCRC },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Keep thousands of particle systems alive without a map, update them every
+	// frame and look them up by their ID, print the timings and exit. Exits with 1 if the ID lookups disagree
+	// with the original list walk. Use it together with -headless, since nothing is rendered.
+	{ "-benchmarkParticles", parseBenchmarkParticles },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Run the center distance checks of the object queries on random positions with
+	// the scalar code and with the batched code, print the timings of both and exit. Exits with 1 if any distance
+	// differs in a single bit.
+	{ "-benchmarkPartitionDistances", parseBenchmarkPartitionDistances },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Start the given map, for example a script heavy campaign mission,
+	// time ScriptEngine::update for the given number of logic frames, print the timings and exit.
+	{ "-benchmarkScripts", parseBenchmarkScripts },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Keep the lines of the loaded INI files in a binary cache in the user data
+	// folder, and replay them on the next start instead of reading the text of the unchanged INI files again.
+	{ "-iniCache", parseINICache },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Split the INI files into lines on worker threads during the startup,
+	// while the main thread parses them in the usual order.
+	{ "-iniPrefetch", parseINIPrefetch },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Write the time of each startup phase and subsystem to the given CSV file.
+	// The same timeline is always written to the debug log.
+	{ "-startupTimeline", parseStartupTimeline },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Compress save games with refpack, lzh or zlib. The game state is serialized
+	// into memory and a background thread compresses and writes it, which shortens the save stall.
+	// Compressed save games are loaded transparently, but retail game versions cannot read them.
+	{ "-saveCompression", parseSaveCompression },
+
+	// TheSuperHackers @performance alanblack166 18/10/2026 Write the peak usage and the lock contention of every memory pool to the
+	// given CSV file when the game exits.
+	{ "-poolStats", parsePoolStats },
+
+	// TheSuperHackers @feature alanblack166 18/10/2026 Write how often every map script, script group, team script and AI script ran
+	// and how long it took to the given CSV file at the end of every game, slowest first. This also works with
+	// -replay, so the scripts of a map can be measured without rendering. Every worker process of -jobs writes
+	// its own file, named after the first replay it simulates.
+	{ "-scriptProfile", parseScriptProfile },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
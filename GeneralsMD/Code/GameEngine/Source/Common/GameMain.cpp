@@ -28,9 +28,15 @@
 
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 
+#include "Common/ArchiveFileSystem.h"
+#include "Common/CRCKernel.h"
 #include "Common/GameEngine.h"
 #include "Common/ReplaySimulation.h"
 
+#include "GameClient/ParticleSys.h"
+
+#include "GameLogic/PartitionManager.h"
+
 
 /**
  * This is the entry point for the game system.
@@ -44,7 +50,24 @@ Int GameMain()
 
 	if (!TheGlobalData->m_simulateReplays.empty())
 	{
-		exitcode = ReplaySimulation::simulateReplays(TheGlobalData->m_simulateReplays, TheGlobalData->m_simulateReplayJobs);
+		exitcode = ReplaySimulation::simulateReplays(TheGlobalData->m_simulateReplays, TheGlobalData->m_simulateReplayJobs,
+			TheGlobalData->m_simulateReplaysPerJob, TheGlobalData->m_simulateReplaySummary);
+	}
+	else if (TheGlobalData->m_benchmarkArchives)
+	{
+		exitcode = TheArchiveFileSystem->benchmarkOpenAllFiles();
+	}
+	else if (TheGlobalData->m_benchmarkCRC)
+	{
+		exitcode = CRCKernel::benchmark();
+	}
+	else if (TheGlobalData->m_benchmarkParticles)
+	{
+		exitcode = TheParticleSystemManager->benchmark();
+	}
+	else if (TheGlobalData->m_benchmarkPartitionDistances)
+	{
+		exitcode = PartitionManager::benchmarkDistances();
 	}
 	else
 	{
@@ -52,6 +75,11 @@ Int GameMain()
 		TheGameEngine->execute();
 	}
 
+	if (!TheGlobalData->m_poolStatsFile.isEmpty())
+	{
+		TheMemoryPoolFactory->memoryPoolStatsReport(TheGlobalData->m_poolStatsFile.str());
+	}
+
 	// since execute() returned, we are exiting the game
 	delete TheGameEngine;
 	TheGameEngine = NULL;
@@ -148,6 +148,18 @@ UnsignedInt GetGameLogicRandomSeedCRC( void )
 	return c.get();
 }
 
+void GetGameLogicRandomState( UnsignedInt state[6], UnsignedInt *baseSeed )
+{
+	memcpy(state, theGameLogicSeed, 6*sizeof(UnsignedInt));
+	*baseSeed = theGameLogicBaseSeed;
+}
+
+void SetGameLogicRandomState( const UnsignedInt state[6], UnsignedInt baseSeed )
+{
+	memcpy(theGameLogicSeed, state, 6*sizeof(UnsignedInt));
+	theGameLogicBaseSeed = baseSeed;
+}
+
 void InitRandom( void )
 {
 #ifdef DETERMINISTIC
@@ -30,6 +30,7 @@
 #include "Common/Player.h"
 #include "Common/GlobalData.h"
 #include "Common/GameEngine.h"
+#include "Common/GameState.h"
 #include "GameClient/ClientInstance.h"
 #include "GameClient/GameWindow.h"
 #include "GameClient/GameWindowManager.h"
@@ -367,8 +368,13 @@ RecorderClass::RecorderClass()
 	//Initializtion(s) inserted
 	m_doingAnalysis = FALSE;
 	m_nextFrame = 0;
+	m_crcMismatchFrame = 0;
 	m_wasDesync = FALSE;
 	//
+	m_checkpointInterval = 0;
+	m_maxCheckpoints = 0;
+	m_nextCheckpointIndex = 0;
+	m_isRestoringCheckpoint = FALSE;
 
 	init(); // just for the heck of it.
 }
@@ -377,6 +383,7 @@ RecorderClass::RecorderClass()
  * Destructor
  */
 RecorderClass::~RecorderClass() {
+	clearCheckpoints();
 }
 
 /**
@@ -408,6 +415,10 @@ void RecorderClass::init() {
  * Reset the recorder to the "initialized state."
  */
 void RecorderClass::reset() {
+	// The engine is reset while a checkpoint is loaded, but the playback must carry on afterwards.
+	if (m_isRestoringCheckpoint)
+		return;
+
 	if (m_file != NULL) {
 		fclose(m_file);
 		m_file = NULL;
@@ -1061,6 +1072,8 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 			// Note: We subtract the queue size from the frame number. This way we calculate the correct frame
 			// the mismatch first happened in case the NetCRCInterval is set to 1 during the game.
 			const UnsignedInt mismatchFrame = TheGameLogic->getFrame() - m_crcInfo->GetQueueSize() - 1;
+			if (m_crcMismatchFrame == 0)
+				m_crcMismatchFrame = mismatchFrame;
 
 			// Now also prints a UI message for it.
 			const UnicodeString mismatchDetailsStr = TheGameText->FETCH_OR_SUBSTITUTE("GUI:CRCMismatchDetails", L"InGame:%8.8X Replay:%8.8X Frame:%d");
@@ -1091,6 +1104,122 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 	//DEBUG_LOG(("RecorderClass::handleCRCMessage() - Skipping CRC of %8.8X from %d (our index is %d)", newCRC, playerIndex, localPlayerIndex));
 }
 
+// TheSuperHackers @feature alanblack166 18/10/2026 Holds everything needed to resume a replay playback at a logic frame.
+class ReplayCheckpoint
+{
+public:
+	ReplayCheckpoint(const CRCInfo &crcInfo) : frame(0), filePosition(0), nextFrame(0), randomBaseSeed(0), crcInfo(crcInfo) {}
+
+	UnsignedInt frame;
+	long filePosition;
+	UnsignedInt nextFrame;
+	UnsignedInt randomState[6];
+	UnsignedInt randomBaseSeed;
+	CRCInfo crcInfo;
+	std::vector<UnsignedByte> gameState;
+};
+
+void RecorderClass::setCheckpointInterval(UnsignedInt frameInterval, UnsignedInt maxCheckpoints)
+{
+	clearCheckpoints();
+	m_checkpointInterval = maxCheckpoints != 0 ? frameInterval : 0;
+	m_maxCheckpoints = maxCheckpoints;
+}
+
+void RecorderClass::clearCheckpoints()
+{
+	for (size_t i = 0; i < m_checkpoints.size(); ++i)
+		delete m_checkpoints[i];
+	m_checkpoints.clear();
+	m_nextCheckpointIndex = 0;
+}
+
+void RecorderClass::updateCheckpoints()
+{
+	if (m_checkpointInterval == 0 || m_mode != RECORDERMODETYPE_SIMULATION_PLAYBACK || m_file == NULL)
+		return;
+
+	// Frame 0 is not useful, the game is only started with the first logic update.
+	const UnsignedInt frame = TheGameLogic->getFrame();
+	if (frame == 0 || frame % m_checkpointInterval != 0)
+		return;
+
+	// Overwrite the oldest checkpoint when the ring buffer is full.
+	ReplayCheckpoint *checkpoint;
+	if (m_checkpoints.size() < m_maxCheckpoints)
+	{
+		checkpoint = NEW ReplayCheckpoint(*m_crcInfo);
+		m_checkpoints.push_back(checkpoint);
+	}
+	else
+	{
+		checkpoint = m_checkpoints[m_nextCheckpointIndex];
+		checkpoint->crcInfo = *m_crcInfo;
+	}
+	m_nextCheckpointIndex = (m_nextCheckpointIndex + 1) % m_maxCheckpoints;
+
+	checkpoint->frame = frame;
+	checkpoint->filePosition = ftell(m_file);
+	checkpoint->nextFrame = m_nextFrame;
+	GetGameLogicRandomState(checkpoint->randomState, &checkpoint->randomBaseSeed);
+
+	if (TheGameState->saveGameToBuffer(checkpoint->gameState) != SC_OK)
+	{
+		DEBUG_LOG(("RecorderClass::updateCheckpoints() - Failed to save checkpoint on frame %d", frame));
+		checkpoint->gameState.clear();
+	}
+}
+
+const ReplayCheckpoint *RecorderClass::findCheckpoint(UnsignedInt frame) const
+{
+	const ReplayCheckpoint *best = NULL;
+	for (size_t i = 0; i < m_checkpoints.size(); ++i)
+	{
+		const ReplayCheckpoint *checkpoint = m_checkpoints[i];
+		if (checkpoint->gameState.empty() || checkpoint->frame > frame)
+			continue;
+		if (best == NULL || checkpoint->frame > best->frame)
+			best = checkpoint;
+	}
+	return best;
+}
+
+UnsignedInt RecorderClass::getCheckpointFrame(UnsignedInt frame) const
+{
+	const ReplayCheckpoint *checkpoint = findCheckpoint(frame);
+	return checkpoint != NULL ? checkpoint->frame : 0;
+}
+
+Bool RecorderClass::restoreCheckpoint(UnsignedInt frame)
+{
+	// The playback file is needed to continue reading commands after the checkpoint.
+	if (!isPlaybackMode() || m_file == NULL)
+		return FALSE;
+
+	const ReplayCheckpoint *checkpoint = findCheckpoint(frame);
+	if (checkpoint == NULL)
+		return FALSE;
+
+	TheCommandList->reset();
+
+	m_isRestoringCheckpoint = TRUE;
+	SaveCode result = TheGameState->loadGameFromBuffer(checkpoint->gameState);
+	m_isRestoringCheckpoint = FALSE;
+
+	if (result != SC_OK || TheGameLogic->getFrame() != checkpoint->frame)
+	{
+		DEBUG_LOG(("RecorderClass::restoreCheckpoint() - Failed to restore checkpoint on frame %d", checkpoint->frame));
+		return FALSE;
+	}
+
+	fseek(m_file, checkpoint->filePosition, SEEK_SET);
+	m_nextFrame = checkpoint->nextFrame;
+	m_crcMismatchFrame = 0;
+	*m_crcInfo = checkpoint->crcInfo;
+	SetGameLogicRandomState(checkpoint->randomState, checkpoint->randomBaseSeed);
+	return TRUE;
+}
+
 /**
  * Returns true if this version of the file is the same as our version of the game
  */
@@ -1223,6 +1352,9 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 
 	DEBUG_LOG(("RecorderClass::playbackFile() - original game was mode %d", m_originalGameMode));
 	
+	clearCheckpoints();
+	m_crcMismatchFrame = 0;
+
 	// TheSuperHackers @fix helmutbuhler 03/04/2025
 	// In case we restart a replay, we need to clear the command list.
 	// Otherwise a crc message remains and messes up the crc calculation on the restarted replay.
@@ -1487,6 +1487,103 @@ void Checkpointable::debugResetCheckpoints()
 }
 #endif
 
+//-----------------------------------------------------------------------------
+// THREAD CACHES for MemoryPool
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// the number of threads that are in or waiting for a ScopedPoolCriticalSection, and the thread
+// that is in it. the critical section is recursive, so a nested lock must not count as contended.
+static LONG thePoolLockUsers = 0;	// not volatile, the VC6 headers take a plain LONG pointer
+static volatile DWORD thePoolLockOwner = 0;
+
+//-----------------------------------------------------------------------------
+/**
+	like ScopedCriticalSection, but counts how often another thread was in or waiting for the
+	lock already. the count is only changed while the lock is held. this is meant for
+	TheMemoryPoolCriticalSection, which is the only lock that the user count above tracks.
+*/
+class ScopedPoolCriticalSection
+{
+private:
+	CriticalSection *m_cs;
+	Bool m_nested;
+
+public:
+	ScopedPoolCriticalSection(CriticalSection *cs, Int *contendedLocks) : m_cs(cs), m_nested(FALSE)
+	{
+		if (!m_cs)
+			return;
+
+		const DWORD threadId = GetCurrentThreadId();
+		m_nested = (thePoolLockOwner == threadId);
+		if (m_nested)
+		{
+			m_cs->enter();
+			return;
+		}
+
+		const Bool contended = InterlockedIncrement(&thePoolLockUsers) > 1;
+		m_cs->enter();
+		thePoolLockOwner = threadId;
+		if (contended)
+			++(*contendedLocks);
+	}
+
+	~ScopedPoolCriticalSection()
+	{
+		if (!m_cs)
+			return;
+
+		if (!m_nested)
+		{
+			thePoolLockOwner = 0;
+			InterlockedDecrement(&thePoolLockUsers);
+		}
+		m_cs->exit();
+	}
+};
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+
+#ifdef _MSC_VER
+	#define MEMORYPOOL_THREAD_LOCAL __declspec(thread)
+#else
+	#define MEMORYPOOL_THREAD_LOCAL __thread
+#endif
+
+enum
+{
+	MAX_THREAD_CACHED_POOLS = 2048,		///< pools created after this many are not cached
+	THREAD_CACHE_BATCH_BYTES = 4096,	///< roughly how many bytes of blocks move between a thread cache and the blobs at once
+	MIN_THREAD_CACHE_BATCH = 4,
+	MAX_THREAD_CACHE_BATCH = 32
+};
+
+/// the free blocks of one pool that one thread keeps, linked through their free block links.
+struct MemoryPoolThreadCacheEntry
+{
+	MemoryPoolSingleBlock	*firstBlock;
+	Int										blockCount;
+	Int										generation;		///< generation of the pool when the blocks were taken
+};
+
+/// the caches of one thread, indexed by the thread cache slot of the pool.
+struct MemoryPoolThreadCache
+{
+	MemoryPoolThreadCacheEntry entries[MAX_THREAD_CACHED_POOLS];
+};
+
+static MEMORYPOOL_THREAD_LOCAL MemoryPoolThreadCache *theThreadCache = NULL;
+
+// these are guarded by TheMemoryPoolCriticalSection. slots are never reused, so a slot
+// of a destroyed pool simply stays empty.
+static MemoryPool *theThreadCachedPools[MAX_THREAD_CACHED_POOLS];
+static Int theThreadCachedPoolCount = 0;
+static Int theThreadCacheGeneration = 0;
+
+#endif // MEMORYPOOL_THREAD_CACHE
+
 //-----------------------------------------------------------------------------
 // METHODS for MemoryPool
 //-----------------------------------------------------------------------------
@@ -1507,7 +1604,13 @@ MemoryPool::MemoryPool() :
 	m_peakUsedBlocksInPool(0),
 	m_firstBlob(NULL),
 	m_lastBlob(NULL),
-	m_firstBlobWithFreeBlocks(NULL)
+	m_firstBlobWithFreeBlocks(NULL),
+	m_contendedLocks(0),
+	m_threadCacheIndex(-1),
+	m_threadCacheBatchCount(0),
+	m_threadCacheGeneration(0),
+	m_threadCacheRefills(0),
+	m_threadCacheFlushes(0)
 {
 }
 
@@ -1529,6 +1632,28 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 	m_firstBlob = NULL;
 	m_lastBlob = NULL;
 	m_firstBlobWithFreeBlocks = NULL;
+	m_contendedLocks = 0;
+	m_threadCacheRefills = 0;
+	m_threadCacheFlushes = 0;
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+		// pools that may not grow keep all their blocks in the blobs, so they run out exactly when they used to.
+		if (m_threadCacheIndex < 0 && m_overflowAllocationCount > 0 && theThreadCachedPoolCount < MAX_THREAD_CACHED_POOLS)
+		{
+			m_threadCacheIndex = theThreadCachedPoolCount++;
+			theThreadCachedPools[m_threadCacheIndex] = this;
+		}
+
+		// a new generation makes every thread forget the blocks it still has from before a reset.
+		m_threadCacheGeneration = ++theThreadCacheGeneration;
+	}
+
+	const Int batchCount = THREAD_CACHE_BATCH_BYTES / (m_allocationSize > 0 ? m_allocationSize : 1);
+	m_threadCacheBatchCount = clamp((Int)MIN_THREAD_CACHE_BATCH, batchCount, (Int)MAX_THREAD_CACHE_BATCH);
+#endif
 
 	// go ahead and init the initial block here (will throw on failure)
 	createBlob(m_initialAllocationCount);
@@ -1540,6 +1665,14 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 */
 MemoryPool::~MemoryPool()
 {   
+#ifdef MEMORYPOOL_THREAD_CACHE
+	if (m_threadCacheIndex >= 0)
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		theThreadCachedPools[m_threadCacheIndex] = NULL;
+	}
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob) 
@@ -1622,14 +1755,12 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 
 //-----------------------------------------------------------------------------
 /**
-	allocate a block from this pool and return it, but don't bother zeroing
-	out the block. if unable to allocate, throw ERROR_OUT_OF_MEMORY. this
-	function will never return null.
+	return a blob that has at least one free block. if there is none, create an overflow
+	blob if mayGrow is true, or return null if it is false. if the pool may not grow,
+	throw ERROR_OUT_OF_MEMORY. the caller must hold the memory pool lock.
 */
-void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
+MemoryPoolBlob* MemoryPool::findBlobWithFreeBlocks(Bool mayGrow)
 {
-	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
-
 	if (m_firstBlobWithFreeBlocks != NULL && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks()) 
 	{
 		// hmm... the current 'free' blob has nothing available. look and see if there
@@ -1650,7 +1781,11 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	// allocate an overflow block.
 	if (m_firstBlobWithFreeBlocks == NULL) 
 	{
-		if (m_overflowAllocationCount == 0)
+		if (!mayGrow)
+		{
+			return NULL;
+		}
+		else if (m_overflowAllocationCount == 0)
 		{
 			throw ERROR_OUT_OF_MEMORY;	// this pool is not allowed to grow
 		}
@@ -1659,8 +1794,124 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 			createBlob(m_overflowAllocationCount); // throws on failure
 		}
 	}
-	
-	MemoryPoolBlob *blob = m_firstBlobWithFreeBlocks;
+
+	return m_firstBlobWithFreeBlocks;
+}
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+//-----------------------------------------------------------------------------
+/**
+	return the cache of the calling thread for this pool, creating the caches of the
+	thread if necessary. return null if this pool is not cached.
+*/
+MemoryPoolThreadCacheEntry *MemoryPool::getThreadCacheEntry()
+{
+	if (m_threadCacheIndex < 0)
+		return NULL;
+
+	MemoryPoolThreadCache *cache = theThreadCache;
+	if (cache == NULL)
+	{
+		cache = (MemoryPoolThreadCache *)::sysAllocateDoNotZero(sizeof(MemoryPoolThreadCache));	// will throw on failure
+		memset(cache, 0, sizeof(MemoryPoolThreadCache));
+		theThreadCache = cache;
+	}
+
+	MemoryPoolThreadCacheEntry *entry = &cache->entries[m_threadCacheIndex];
+	if (entry->generation != m_threadCacheGeneration)
+	{
+		// the pool was reset since this thread last used it. the blobs of the
+		// cached blocks are gone, so just forget them.
+		entry->firstBlock = NULL;
+		entry->blockCount = 0;
+		entry->generation = m_threadCacheGeneration;
+	}
+	return entry;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	move a batch of free blocks from the blobs into the (empty) cache of the calling thread.
+	the blocks count as used from now on. if not even one block is available, throw 
+	ERROR_OUT_OF_MEMORY.
+*/
+void MemoryPool::refillThreadCache(MemoryPoolThreadCacheEntry *entry)
+{
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
+
+	for (Int i = 0; i < m_threadCacheBatchCount; ++i)
+	{
+		// only the first block may grow the pool, so a batch never creates a blob just to fill the cache.
+		MemoryPoolBlob *blob = findBlobWithFreeBlocks(i == 0);	// throws on failure
+		if (blob == NULL)
+			break;
+
+		MemoryPoolSingleBlock *block = blob->allocateSingleBlock();
+		block->setNextFreeBlock(entry->firstBlock);
+		entry->firstBlock = block;
+		++entry->blockCount;
+
+		// bookkeeping
+		++m_usedBlocksInPool;
+	}
+
+	if (m_peakUsedBlocksInPool < m_usedBlocksInPool)
+		m_peakUsedBlocksInPool = m_usedBlocksInPool;
+	++m_threadCacheRefills;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give blocks from the cache of the calling thread back to their blobs, until
+	keepCount of them are left.
+*/
+void MemoryPool::flushThreadCache(MemoryPoolThreadCacheEntry *entry, Int keepCount)
+{
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
+
+	while (entry->blockCount > keepCount)
+	{
+		MemoryPoolSingleBlock *block = entry->firstBlock;
+		entry->firstBlock = block->getNextFreeBlock();
+		--entry->blockCount;
+
+		MemoryPoolBlob *blob = block->getOwningBlob();
+		blob->freeSingleBlock(block);
+		if (!m_firstBlobWithFreeBlocks)
+			m_firstBlobWithFreeBlocks = blob;
+
+		// bookkeeping
+		--m_usedBlocksInPool;
+	}
+	++m_threadCacheFlushes;
+}
+#endif // MEMORYPOOL_THREAD_CACHE
+
+//-----------------------------------------------------------------------------
+/**
+	allocate a block from this pool and return it, but don't bother zeroing
+	out the block. if unable to allocate, throw ERROR_OUT_OF_MEMORY. this
+	function will never return null.
+*/
+void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
+{
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MemoryPoolThreadCacheEntry *entry = getThreadCacheEntry();
+	if (entry != NULL)
+	{
+		if (entry->firstBlock == NULL)
+			refillThreadCache(entry);	// throws on failure
+
+		MemoryPoolSingleBlock *block = entry->firstBlock;
+		entry->firstBlock = block->getNextFreeBlock();
+		--entry->blockCount;
+		return block->getUserData();
+	}
+#endif
+
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
+
+	MemoryPoolBlob *blob = findBlobWithFreeBlocks(TRUE);	// throws on failure
 
 	DEBUG_ASSERTCRASH(blob, ("no blob with free blocks available in MemoryPool::allocate"));
 		
@@ -1713,7 +1964,22 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
-	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MemoryPoolThreadCacheEntry *entry = getThreadCacheEntry();
+	if (entry != NULL)
+	{
+		MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+		DEBUG_ASSERTCRASH(block->getOwningBlob() && block->getOwningBlob()->getOwningPool() == this, ("block does not belong to this pool"));
+
+		block->setNextFreeBlock(entry->firstBlock);
+		entry->firstBlock = block;
+		if (++entry->blockCount > 2 * m_threadCacheBatchCount)
+			flushThreadCache(entry, m_threadCacheBatchCount);
+		return;
+	}
+#endif
+
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
 
 	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
 	MemoryPoolBlob *blob = block->getOwningBlob();
@@ -1772,7 +2038,7 @@ Int MemoryPool::countBlobsInPool()
 */
 Int MemoryPool::releaseEmpties()
 {
-	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
 
 	Int released = 0;
 
@@ -1793,7 +2059,7 @@ Int MemoryPool::releaseEmpties()
 */
 void MemoryPool::reset()
 {
-	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+	ScopedPoolCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection, &m_contendedLocks);
 
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
@@ -1846,6 +2112,56 @@ void MemoryPool::removeFromList(MemoryPool **pHead)
 	}
 }
 
+//-----------------------------------------------------------------------------
+/**
+	write the sizing and lock contention statistics of the pool to the file as a CSV line.
+	if the pool is null, write the column headers. PEAK includes the blocks that the 
+	threads keep in their caches, since those are taken from the blobs as well.
+*/
+/*static*/ void MemoryPool::poolStatsReport( MemoryPool *pool, FILE *fp )
+{
+	if (!pool)
+	{
+		fprintf( fp, "name,blockSize,initial,overflow,used,total,peak,blobs,contendedLocks,cacheRefills,cacheFlushes\n" );
+	}
+	else
+	{
+		fprintf( fp, "%s,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n",
+			pool->m_poolName,pool->m_allocationSize,pool->m_initialAllocationCount,pool->m_overflowAllocationCount,
+			pool->m_usedBlocksInPool,pool->m_totalBlocksInPool,pool->m_peakUsedBlocksInPool,pool->countBlobsInPool(),
+			pool->m_contendedLocks,pool->m_threadCacheRefills,pool->m_threadCacheFlushes );
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the blocks in the caches of the calling thread back to their pools, and 
+	free the caches. threads other than the main thread call this before they exit.
+*/
+/*static*/ void MemoryPool::releaseThreadCache()
+{
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MemoryPoolThreadCache *cache = theThreadCache;
+	if (cache == NULL)
+		return;
+
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+		for (Int i = 0; i < theThreadCachedPoolCount; ++i)
+		{
+			MemoryPoolThreadCacheEntry *entry = &cache->entries[i];
+			MemoryPool *pool = theThreadCachedPools[i];
+			if (pool != NULL && entry->blockCount > 0 && entry->generation == pool->m_threadCacheGeneration)
+				pool->flushThreadCache(entry, 0);
+		}
+	}
+
+	theThreadCache = NULL;
+	::sysFree((void *)cache);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 #ifdef MEMORYPOOL_DEBUG
 /**
@@ -1860,20 +2176,20 @@ void MemoryPool::removeFromList(MemoryPool **pHead)
 
 	if (!pool)
 	{
-		DEBUG_LOG(("%s,%32s,%6s,%6s,%6s,%6s,%6s,%6s",PREPEND,"POOLNAME","BLKSZ","INIT","OVRFL","USED","TOTAL","PEAK"));
+		DEBUG_LOG(("%s,%32s,%6s,%6s,%6s,%6s,%6s,%6s,%7s",PREPEND,"POOLNAME","BLKSZ","INIT","OVRFL","USED","TOTAL","PEAK","CONTEND"));
 		if( fp )
-			fprintf( fp, "%s,%32s,%6s,%6s,%6s,%6s,%6s,%6s\n",PREPEND,"POOLNAME","BLKSZ","INIT","OVRFL","USED","TOTAL","PEAK" );
+			fprintf( fp, "%s,%32s,%6s,%6s,%6s,%6s,%6s,%6s,%7s\n",PREPEND,"POOLNAME","BLKSZ","INIT","OVRFL","USED","TOTAL","PEAK","CONTEND" );
 	}
 	else
 	{
-		DEBUG_LOG(("%s,%32s,%6d,%6d,%6d,%6d,%6d,%6d",PREPEND,
+		DEBUG_LOG(("%s,%32s,%6d,%6d,%6d,%6d,%6d,%6d,%7d",PREPEND,
 			pool->m_poolName,pool->m_allocationSize,pool->m_initialAllocationCount,pool->m_overflowAllocationCount,
-			pool->m_usedBlocksInPool,pool->m_totalBlocksInPool,pool->m_peakUsedBlocksInPool));
+			pool->m_usedBlocksInPool,pool->m_totalBlocksInPool,pool->m_peakUsedBlocksInPool,pool->m_contendedLocks));
 		if( fp )
 		{
-			fprintf( fp, "%s,%32s,%6d,%6d,%6d,%6d,%6d,%6d\n",PREPEND,
+			fprintf( fp, "%s,%32s,%6d,%6d,%6d,%6d,%6d,%6d,%7d\n",PREPEND,
 				pool->m_poolName,pool->m_allocationSize,pool->m_initialAllocationCount,pool->m_overflowAllocationCount,
-				pool->m_usedBlocksInPool,pool->m_totalBlocksInPool,pool->m_peakUsedBlocksInPool );
+				pool->m_usedBlocksInPool,pool->m_totalBlocksInPool,pool->m_peakUsedBlocksInPool,pool->m_contendedLocks );
 		}
 	}
 }
@@ -2161,6 +2477,16 @@ void DynamicMemoryAllocator::debugIgnoreLeaksForThisBlock(void* pBlockPtr)
 */
 void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes DECLARE_LITERALSTRING_ARG2)
 {
+#ifdef MEMORYPOOL_THREAD_CACHE
+	// the pools with thread caches do not need the dma lock. m_usedBlocksInDma then only
+	// counts the other blocks, which is all the dma destructor checks.
+	{
+		MemoryPool *pool = findPoolForSize(numBytes);
+		if (pool != NULL && pool->hasThreadCache())
+			return pool->allocateBlockDoNotZeroImplementation(PASS_LITERALSTRING_ARG1);	// throws on failure
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 	void *result = NULL;
@@ -2277,6 +2603,17 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	{
+		MemoryPoolBlob *blob = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr)->getOwningBlob();
+		if (blob != NULL && blob->getOwningPool()->hasThreadCache())
+		{
+			blob->getOwningPool()->freeBlock(pBlockPtr);
+			return;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 #ifdef MEMORYPOOL_CHECK_BLOCK_OWNERSHIP
@@ -2963,6 +3300,33 @@ void MemoryPoolFactory::debugResetCheckpoints()
 }
 #endif
 
+//-----------------------------------------------------------------------------
+/**
+	write the sizing and lock contention statistics of every pool to a CSV file. unlike
+	memoryPoolUsageReport, this works in the release builds, where the pools are tuned for.
+*/
+void MemoryPoolFactory::memoryPoolStatsReport( const char* filename )
+{
+	FILE *fp = fopen(filename, "w");
+	if (fp == NULL)
+	{
+		DEBUG_LOG(("could not open/create pool stats file %s", filename));
+		return;
+	}
+
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+		MemoryPool::poolStatsReport(NULL, fp);
+		for (MemoryPool *pool = m_firstPoolInFactory; pool; pool = pool->getNextPoolInList())
+		{
+			MemoryPool::poolStatsReport(pool, fp);
+		}
+	}
+
+	fclose(fp);
+}
+
 //-----------------------------------------------------------------------------
 void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead )
 {
@@ -3468,6 +3832,15 @@ void initMemoryManager()
 
 }
 
+//-----------------------------------------------------------------------------
+/**
+	Give the free blocks that the calling thread keeps in its pool caches back to the pools.
+*/
+void releaseMemoryPoolThreadCache()
+{
+	MemoryPool::releaseThreadCache();
+}
+
 //-----------------------------------------------------------------------------
 Bool isMemoryManagerOfficiallyInited()
 {
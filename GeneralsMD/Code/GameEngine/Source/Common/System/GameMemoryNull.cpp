@@ -89,6 +89,10 @@ void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appen
 {
 }
 
+void MemoryPoolFactory::memoryPoolStatsReport( const char* filename )
+{
+}
+
 #ifdef MEMORYPOOL_DEBUG
 void MemoryPoolFactory::debugMemoryReport(Int flags, Int startCheckpoint, Int endCheckpoint, FILE *fp )
 {
@@ -123,6 +127,11 @@ void initMemoryManager()
 	theMainInitFlag = true;
 }
 
+//-----------------------------------------------------------------------------
+void releaseMemoryPoolThreadCache()
+{
+}
+
 //-----------------------------------------------------------------------------
 Bool isMemoryManagerOfficiallyInited()
 {
@@ -296,6 +296,9 @@ GameState::~GameState( void )
 	// clear any available game 
 	clearAvailableGames();
 
+	// finish writing the last save game file
+	XferSave::waitForPendingWrites();
+
 }  // end ~GameState
 
 // ------------------------------------------------------------------------------------------------
@@ -529,6 +532,27 @@ AsciiString GameState::findNextSaveFilename( UnicodeString desc )
 
 }  // end findNextSaveFilename
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @fix alanblack166 18/10/2026 Compressed save files are written in the background
+	* after saveGame returns, so a failed write is only known later. Tell the user about it here. */
+// ------------------------------------------------------------------------------------------------
+static void reportSaveWriteError( void )
+{
+
+	AsciiString filepath;
+	if( !XferSave::takeWriteError( &filepath ) )
+		return;
+
+	UnicodeString ufilepath;
+	ufilepath.translate(filepath);
+
+	UnicodeString msg;
+	msg.format( TheGameText->fetch("GUI:ErrorSavingGame"), ufilepath.str() );
+
+	MessageBoxOk(TheGameText->fetch("GUI:Error"), msg, NULL);
+
+}  // end reportSaveWriteError
+
 // ------------------------------------------------------------------------------------------------
 /** Save the current state of the engine in a save file
 	* NOTE: filename is a *filename only* */
@@ -537,6 +561,9 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 															SaveFileType saveType, SnapshotType which )
 {
 
+	// the previous save may have failed to write
+	reportSaveWriteError();
+
 	// if there is no filename, this is a new file being created, find an appropriate filename
 	if( filename.isEmpty() )
 		filename = findNextSaveFilename( desc );
@@ -559,6 +586,7 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 
 	// open the save file
 	XferSave xferSave;
+	xferSave.setCompression( (CompressionType)TheGlobalData->m_saveGameCompression );
 	try {
 		xferSave.open( filepath );
 	} catch(...) {
@@ -646,6 +674,9 @@ SaveCode GameState::missionSave( void )
 SaveCode GameState::loadGame( AvailableGameInfo gameInfo )
 {
 
+	// the last save may have failed to write
+	reportSaveWriteError();
+
 	// sanity check for file
 	if( doesSaveGameExist( gameInfo.filename ) == FALSE )
 		return SC_FILE_NOT_FOUND;
@@ -758,6 +789,97 @@ SaveCode GameState::loadGame( AvailableGameInfo gameInfo )
 
 }  // end loadGame
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature alanblack166 18/10/2026 Save the game state into a memory buffer. This writes the same data
+	* as saveGame, but without touching the disk or the user interface. Used for replay checkpoints. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::saveGameToBuffer( std::vector<UnsignedByte> &buffer )
+{
+
+	// the checkpoint is a normal save, but the campaign may still need its pending mission save info
+	SaveGameInfo *gameInfo = getSaveGameInfo();
+	LatchRestore<SaveFileType> saveFileType( gameInfo->saveFileType, SAVE_FILE_TYPE_NORMAL );
+	LatchRestore<AsciiString> missionMapName( gameInfo->missionMapName, AsciiString::TheEmptyString );
+
+	XferSave xferSave;
+	xferSave.openBuffer( "GameStateBuffer", &buffer );
+
+	SaveCode result = SC_OK;
+	try
+	{
+		xferSaveData( &xferSave, SNAPSHOT_SAVELOAD );
+	}
+	catch( ... )
+	{
+		DEBUG_LOG(( "GameState::saveGameToBuffer - Error saving game state" ));
+		result = SC_ERROR;
+	}
+
+	xferSave.close();
+	return result;
+
+}  // end saveGameToBuffer
+
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature alanblack166 18/10/2026 Load the game state from a memory buffer written by saveGameToBuffer.
+	* Like loadGame, this resets the game engine first. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::loadGameFromBuffer( const std::vector<UnsignedByte> &buffer )
+{
+
+	if( buffer.empty() )
+		return SC_INVALID_DATA;
+
+	TheGameStateMap->clearScratchPadMaps();
+
+	XferLoad xferLoad;
+	xferLoad.openBuffer( "GameStateBuffer", &buffer[ 0 ], buffer.size() );
+
+	// clear out the game engine
+	TheGameEngine->reset();
+
+	// lock creation of new ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( TRUE );
+
+	LatchRestore<Bool> inLoadGame(m_isInLoadGame, TRUE);
+
+	Bool error = FALSE;
+	try
+	{
+		xferSaveData( &xferLoad, SNAPSHOT_SAVELOAD );
+	}
+	catch( ... )
+	{
+		error = TRUE;
+	}
+
+	xferLoad.close();
+
+	// un-savelock the ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( FALSE );
+
+	try
+	{
+		gameStatePostProcessLoad();
+	}
+	catch (...)
+	{
+		error = TRUE;
+	}
+
+	if( error == TRUE )
+	{
+		DEBUG_LOG(( "GameState::loadGameFromBuffer - Error loading game state" ));
+		if (TheGameLogic->isInGame())
+			TheGameLogic->clearGameData( FALSE );
+		TheGameEngine->reset();
+		return SC_INVALID_DATA;
+	}
+
+	return SC_OK;
+
+}  // end loadGameFromBuffer
+
 //-------------------------------------------------------------------------------------------------
 AsciiString GameState::getSaveDirectory() const
 {
@@ -62,11 +62,8 @@ void CRC::computeCRC( const void *buf, Int len )
 
 	//crc = 0;
 
-	UnsignedByte *uintPtr = (UnsignedByte *)buf;
-
-	for (int i=0 ; i<len ; i++) {
-		addCRC (*(uintPtr++));
-	}
+	// TheSuperHackers @performance alanblack166 18/10/2026 The kernel produces the same CRC as addCRC for every byte.
+	crc = CRCKernel::addBytes(crc, (const UnsignedByte *)buf, len);
 	//crc = htonl(crc);
 }
 
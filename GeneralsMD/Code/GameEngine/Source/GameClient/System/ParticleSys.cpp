@@ -2422,7 +2422,10 @@ void ParticleSystem::xfer( Xfer *xfer )
 	ParticleSystemInfo::xfer( xfer );
 
 	// particle system ID
+	ParticleSystemID oldSystemID = m_systemID;
 	xfer->xferUser( &m_systemID, sizeof( ParticleSystemID ) );
+	if( m_systemID != oldSystemID )
+		TheParticleSystemManager->friend_changeParticleSystemID( this, oldSystemID );
 
 	// attached to drawable id
 	xfer->xferDrawableID( &m_attachedToDrawableID );
@@ -2909,6 +2912,7 @@ void ParticleSystemManager::reset( void )
 		deleteInstance(m_allParticleSystemList.front());
 	}
 	DEBUG_ASSERTCRASH(m_particleSystemCount == 0, ("ParticleSystemManager::reset: m_particleSystemCount is %u, not 0", m_particleSystemCount));
+	m_allParticleSystemsByID.clear();
 
 	// sanity, our lists must be empty!!
 	for( Int i = 0; i < NUM_PARTICLE_PRIORITIES; ++i )
@@ -2947,6 +2951,14 @@ void ParticleSystemManager::update( void )
 	// update the last logic frame.
 	m_lastLogicFrameUpdate = TheGameLogic->getFrame();
 
+	updateSystems();
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Update all particle systems, and delete the ones that are done */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::updateSystems( void )
+{
 	//USE_PERF_TIMER(ParticleSystemManager)
 	ParticleSystemListIt it = m_allParticleSystemList.begin(); 
 	while( it != m_allParticleSystemList.end() )  
@@ -3006,18 +3018,13 @@ ParticleSystem *ParticleSystemManager::findParticleSystem( ParticleSystemID id )
 	if (id == INVALID_PARTICLE_SYSTEM_ID)
 		return NULL;	// my, that was easy
 
-	ParticleSystem *system = NULL;
-
-	for( ParticleSystemListIt it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it ) {
-		system = *it;
-		DEBUG_ASSERTCRASH(system != NULL, ("ParticleSystemManager::findParticleSystem: ParticleSystem is null"));
-
-		if( system->getSystemID() == id ) {
-			return system;
-		}
-	}
+	ParticleSystemIDMap::const_iterator it = m_allParticleSystemsByID.find(id);
+	if (it == m_allParticleSystemsByID.end())
+		return NULL;
 
-	return NULL;
+	ParticleSystem *system = *it->second;
+	DEBUG_ASSERTCRASH(system != NULL, ("ParticleSystemManager::findParticleSystem: ParticleSystem is null"));
+	return system;
 
 }  // end findParticleSystem
 
@@ -3183,6 +3190,11 @@ void ParticleSystemManager::friend_addParticleSystem( ParticleSystem *particleSy
 	DEBUG_ASSERTCRASH(particleSystemToAdd != NULL, ("ParticleSystemManager::friend_addParticleSystem: ParticleSystem is null"));
 	m_allParticleSystemList.push_back(particleSystemToAdd);
 	++m_particleSystemCount;
+
+	// If an ID were ever taken twice, the older system keeps it, which is what the list walk found.
+	ParticleSystemListIt it = m_allParticleSystemList.end();
+	--it;
+	m_allParticleSystemsByID.insert(std::make_pair(particleSystemToAdd->getSystemID(), it));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -3190,6 +3202,15 @@ void ParticleSystemManager::friend_addParticleSystem( ParticleSystem *particleSy
 // ------------------------------------------------------------------------------------------------
 void ParticleSystemManager::friend_removeParticleSystem( ParticleSystem *particleSystemToRemove )
 {
+	ParticleSystemIDMap::iterator found = m_allParticleSystemsByID.find(particleSystemToRemove->getSystemID());
+	if (found != m_allParticleSystemsByID.end() && *found->second == particleSystemToRemove) {
+		m_allParticleSystemList.erase(found->second);
+		m_allParticleSystemsByID.erase(found);
+		--m_particleSystemCount;
+		return;
+	}
+
+	// Only a system whose ID another system already had is missing from the table.
 	ParticleSystemListIt it = std::find(m_allParticleSystemList.begin(), m_allParticleSystemList.end(), particleSystemToRemove);
 	if (it != m_allParticleSystemList.end()) {
 		m_allParticleSystemList.erase(it);
@@ -3199,6 +3220,173 @@ void ParticleSystemManager::friend_removeParticleSystem( ParticleSystem *particl
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Move a particle system to its new ID in the table. Loading a save game gives the systems back
+	* the IDs they were saved with. */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::friend_changeParticleSystemID( ParticleSystem *particleSystem, ParticleSystemID oldID )
+{
+	ParticleSystemIDMap::iterator found = m_allParticleSystemsByID.find(oldID);
+	if (found == m_allParticleSystemsByID.end() || *found->second != particleSystem) {
+		DEBUG_CRASH(("ParticleSystemManager::friend_changeParticleSystemID: ParticleSystem was not recognized"));
+		return;
+	}
+
+	ParticleSystemListIt it = found->second;
+	m_allParticleSystemsByID.erase(found);
+	if (!m_allParticleSystemsByID.insert(std::make_pair(particleSystem->getSystemID(), it)).second) {
+		DEBUG_CRASH(("ParticleSystemManager::friend_changeParticleSystemID: ID %u is already taken", (UnsignedInt)particleSystem->getSystemID()));
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// The original list walk of findParticleSystem, which the benchmark compares the table against.
+// ------------------------------------------------------------------------------------------------
+static ParticleSystem *referenceFindParticleSystem( ParticleSystemManager::ParticleSystemList &systems, ParticleSystemID id )
+{
+	for( ParticleSystemManager::ParticleSystemListIt it = systems.begin(); it != systems.end(); ++it ) {
+		if( (*it)->getSystemID() == id ) {
+			return *it;
+		}
+	}
+	return NULL;
+}
+
+// ------------------------------------------------------------------------------------------------
+static Int64 getBenchmarkTicks()
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance alanblack166 18/10/2026 Keeps a few thousand particle systems alive without a map and
+	* updates them like the client does every frame, while the oldest ones are destroyed by their ID
+	* and replaced, like the effects of a battle come and go. Every few frames each live system and each
+	* recently destroyed one is looked up by its ID, once with the table and once with the original
+	* list walk. Nothing is rendered, and the systems of drawable particles are left out, so this is
+	* meant to run with -headless. Prints the timings and returns 1 if the lookups disagree. */
+// ------------------------------------------------------------------------------------------------
+Int ParticleSystemManager::benchmark( void )
+{
+	Int64 ticksPerSecond = 1;
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		ticksPerSecond = freq.QuadPart;
+
+	const UnsignedInt systemCount = 4000;
+	const UnsignedInt replacedPerFrame = 40;
+	const Int frameCount = 300;
+	const Int lookupInterval = 10;
+
+	std::vector<const ParticleSystemTemplate *> templates;
+	for (TemplateMap::const_iterator it = m_templateMap.begin(); it != m_templateMap.end(); ++it)
+	{
+		if (it->second->m_particleType != ParticleSystemInfo::DRAWABLE)
+			templates.push_back(it->second);
+	}
+
+	if (templates.empty())
+	{
+		printf("ParticleSystemManager::benchmark - There are no particle system templates\n");
+		return 1;
+	}
+
+	reset();
+
+	std::vector<ParticleSystemID> createdIDs;
+	size_t nextToDestroy = 0;
+	std::vector<ParticleSystemID> ids;
+	std::vector<ParticleSystem *> found;
+	Int64 updateTicks = 0;
+	Int64 tableTicks = 0;
+	Int64 listTicks = 0;
+	UnsignedInt lookupCount = 0;
+	UnsignedInt peakSystemCount = 0;
+	UnsignedInt peakParticleCount = 0;
+	Bool allSame = TRUE;
+
+	for (Int frame = 0; frame < frameCount; ++frame)
+	{
+		if (frame > 0)
+		{
+			for (UnsignedInt i = 0; i < replacedPerFrame && nextToDestroy < createdIDs.size(); ++i)
+				destroyParticleSystemByID(createdIDs[nextToDestroy++]);
+		}
+
+		const UnsignedInt createCount = (frame == 0) ? systemCount : replacedPerFrame;
+		for (UnsignedInt i = 0; i < createCount; ++i)
+		{
+			const UnsignedInt index = (UnsignedInt)createdIDs.size();
+			ParticleSystem *system = createParticleSystem(templates[index % templates.size()]);
+			if (system == NULL)
+				continue;
+
+			Coord3D pos;
+			pos.x = (Real)(index % 64) * 40.0f;
+			pos.y = (Real)((index / 64) % 64) * 40.0f;
+			pos.z = 0.0f;
+			system->setPosition(&pos);
+			createdIDs.push_back(system->getSystemID());
+		}
+
+		if (frame % lookupInterval == 0)
+		{
+			ids.clear();
+			for (ParticleSystemListIt it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it)
+				ids.push_back((*it)->getSystemID());
+
+			// Modules keep the IDs of their systems after the systems are gone, and look them up anyway.
+			for (size_t i = nextToDestroy > replacedPerFrame ? nextToDestroy - replacedPerFrame : 0; i < nextToDestroy; ++i)
+				ids.push_back(createdIDs[i]);
+
+			found.resize(ids.size());
+
+			Int64 startTicks = getBenchmarkTicks();
+			for (size_t i = 0; i < ids.size(); ++i)
+				found[i] = findParticleSystem(ids[i]);
+			tableTicks += getBenchmarkTicks() - startTicks;
+
+			startTicks = getBenchmarkTicks();
+			for (size_t i = 0; i < ids.size(); ++i)
+			{
+				if (referenceFindParticleSystem(m_allParticleSystemList, ids[i]) != found[i])
+					allSame = FALSE;
+			}
+			listTicks += getBenchmarkTicks() - startTicks;
+
+			lookupCount += (UnsignedInt)ids.size();
+		}
+
+		const Int64 startTicks = getBenchmarkTicks();
+		updateSystems();
+		updateTicks += getBenchmarkTicks() - startTicks;
+
+		if (m_particleSystemCount > peakSystemCount)
+			peakSystemCount = m_particleSystemCount;
+		if (m_particleCount > peakParticleCount)
+			peakParticleCount = m_particleCount;
+	}
+
+	const double updateMilliseconds = (double)updateTicks * 1000.0 / (double)ticksPerSecond / (double)frameCount;
+	const double tableNanoseconds = lookupCount ? (double)tableTicks * 1.0e9 / (double)ticksPerSecond / (double)lookupCount : 0.0;
+	const double listNanoseconds = lookupCount ? (double)listTicks * 1.0e9 / (double)ticksPerSecond / (double)lookupCount : 0.0;
+
+	printf("%u particle systems created from %d templates, peak %u systems and %u particles\n",
+		(UnsignedInt)createdIDs.size(), (Int)templates.size(), peakSystemCount, peakParticleCount);
+	printf("update %8.3f ms per frame over %d frames\n", updateMilliseconds, frameCount);
+	printf("lookup by ID: list walk %10.1f ns, table %8.1f ns, %8.1fx, over %u lookups, results %s\n",
+		listNanoseconds, tableNanoseconds, tableNanoseconds > 0.0 ? listNanoseconds / tableNanoseconds : 0.0,
+		lookupCount, allSame ? "match" : "DIFFER");
+	DEBUG_LOG(("ParticleSystemManager::benchmark - update %.3f ms per frame, lookup list walk %.1f ns, table %.1f ns, results %s",
+		updateMilliseconds, listNanoseconds, tableNanoseconds, allSame ? "match" : "differ"));
+
+	reset();
+
+	return allSame ? 0 : 1;
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Remove the oldest N number of particles from the lowest priority lists first.  We will
  * not remove particles from any priorities higher or equal to the priorityCap parameter. */
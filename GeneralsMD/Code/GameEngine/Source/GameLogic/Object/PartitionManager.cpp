@@ -53,6 +53,7 @@
 #include "Common/DiscreteCircle.h"
 #include "Common/GameEngine.h"
 #include "Common/GameState.h"
+#include "Common/LogicProfiler.h"
 #include "Common/MessageStream.h"
 #include "Common/NameKeyGenerator.h"
 #include "Common/PerfTimer.h"
@@ -97,6 +98,14 @@
 #endif 
 
 
+// TheSuperHackers @performance alanblack166 18/10/2026 The batched distance checks use SSE only when the compiler also uses
+// SSE for scalar float math. Then both produce the same IEEE single precision results. With x87 float
+// math, the batch falls back to the scalar code, so that the results cannot differ from the originals.
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE_MATH__)
+#define PM_BATCH_DISTANCE_SSE
+#include <xmmintrin.h>
+#endif
+
 extern void addIcon(const Coord3D *pos, Real width, Int numFramesDuration, RGBColor color);
 
 const Real HUGE_DIST_SQR = (HUGE_DIST*HUGE_DIST);
@@ -943,6 +952,61 @@ static Bool distCalcProc_BoundaryAndBoundary_3D(
 	return abDistSqr < maxDistSqr;
 }
 
+//-----------------------------------------------------------------------------
+/**
+	Computes the same squared distance as distCalcProc_CenterAndCenter_2D/3D for count positions
+	around center, and flags the positions that are closer than maxDistSqr. The operations are
+	done in the same order as in the scalar procs, so the distances are bit-identical.
+*/
+static void calcCenterDistSqrBatch(
+	const Coord3D *center,
+	Bool is3D,
+	const Real *xs,
+	const Real *ys,
+	const Real *zs,
+	Int count,
+	Real maxDistSqr,
+	Real *distSqrs,
+	UnsignedByte *inRange
+)
+{
+	Int i = 0;
+
+#ifdef PM_BATCH_DISTANCE_SSE
+	const __m128 centerX = _mm_set1_ps(center->x);
+	const __m128 centerY = _mm_set1_ps(center->y);
+	const __m128 centerZ = _mm_set1_ps(center->z);
+	const __m128 maxDistSqr4 = _mm_set1_ps(maxDistSqr);
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), centerX);
+		const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), centerY);
+		__m128 distSqr = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+		if (is3D)
+		{
+			const __m128 dz = _mm_sub_ps(_mm_loadu_ps(zs + i), centerZ);
+			distSqr = _mm_add_ps(distSqr, _mm_mul_ps(dz, dz));
+		}
+		_mm_storeu_ps(distSqrs + i, distSqr);
+
+		const Int mask = _mm_movemask_ps(_mm_cmplt_ps(distSqr, maxDistSqr4));
+		inRange[i + 0] = (mask >> 0) & 1;
+		inRange[i + 1] = (mask >> 1) & 1;
+		inRange[i + 2] = (mask >> 2) & 1;
+		inRange[i + 3] = (mask >> 3) & 1;
+	}
+#endif
+
+	for (; i < count; ++i)
+	{
+		Real distSqr = sqr(xs[i] - center->x) + sqr(ys[i] - center->y);
+		if (is3D)
+			distSqr += sqr(zs[i] - center->z);
+		distSqrs[i] = distSqr;
+		inRange[i] = distSqr < maxDistSqr;
+	}
+}
+
 //-----------------------------------------------------------------------------
 //         Private Types                                                     
 //-----------------------------------------------------------------------------
@@ -1133,6 +1197,7 @@ CellAndObjectIntersection::CellAndObjectIntersection()
 	m_module = NULL;
 	m_prevCoi = NULL;
 	m_nextCoi = NULL;
+	m_moduleIndex = -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -1197,11 +1262,14 @@ void CellAndObjectIntersection::addCoverage(PartitionCell *cell, PartitionData *
 		return;
 	}
 
-	if (m_cell == NULL)
-		cell->friend_addToCellList(this);
+	const Bool isNewCoverage = (m_cell == NULL);
 
 	m_cell = cell;
 	m_module = module;
+
+	// the cell needs our module to add it to its module array.
+	if (isNewCoverage)
+		cell->friend_addToCellList(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -1231,6 +1299,7 @@ PartitionCell::PartitionCell()
 	//
 	m_firstCoiInCell = NULL;
 	m_coiCount = 0;
+	m_emptyModuleSlots = 0;
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	m_loTerrainZ = HUGE_DIST;		// huge positive
 	m_hiTerrainZ = -HUGE_DIST;	// huge negative
@@ -1274,6 +1343,7 @@ void PartitionCell::invalidateShroudedStatusForAllCois(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::addLooker(Int playerIndex)
 {
+	ThePartitionManager->markCellCRCDirty( this );
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 	// The decreasing Algorithm: A 1 will go straight to -1, otherwise it just gets decremented
 	m_shroudLevel[playerIndex].m_currentShroud = min( m_shroudLevel[playerIndex].m_currentShroud - 1, -1 );
@@ -1305,6 +1375,7 @@ void PartitionCell::addLooker(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::removeLooker(Int playerIndex)
 {
+	ThePartitionManager->markCellCRCDirty( this );
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 	// the increasing Algorithm: a -1 goes up to min(1,activeLevel), otherwise it just gets incremented
 	if( m_shroudLevel[playerIndex].m_currentShroud == -1 )
@@ -1341,6 +1412,7 @@ void PartitionCell::removeLooker(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::addShrouder( Int playerIndex )
 {
+	ThePartitionManager->markCellCRCDirty( this );
 	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
 	// Increasing active shroud: activeLevel gets incremented, and CS is set to 1 if at zero
 	// do the algorithm
@@ -1368,6 +1440,7 @@ void PartitionCell::addShrouder( Int playerIndex )
 //-----------------------------------------------------------------------------
 void PartitionCell::removeShrouder( Int playerIndex )
 {
+	ThePartitionManager->markCellCRCDirty( this );
 	// Decreasing active shroud: just decrement activeLevel.  This will never result in a client change.
 	// Either it was passive shroud and is now active, or it was being looked at and still is.
 	m_shroudLevel[playerIndex].m_activeShroudLevel--;
@@ -1467,6 +1540,15 @@ void PartitionCell::friend_addToCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_addToCellList(&m_firstCoiInCell);
 		++m_coiCount;
+		ModuleSlot slot;
+		slot.module = coi->getModule();
+		slot.coi = coi;
+		coi->friend_setModuleIndex((Int)m_modules.size());
+		m_modules.push_back(slot);
+#ifdef FASTER_GCO
+		if (ThePartitionManager)
+			ThePartitionManager->friend_invalidateGcoCache(m_cellX, m_cellY);
+#endif
 	}
 }
 
@@ -1477,9 +1559,52 @@ void PartitionCell::friend_removeFromCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_removeFromCellList(&m_firstCoiInCell);
 		--m_coiCount;
+
+		// the remaining modules must keep their order, since queries visit them in that order
+		// and break distance ties by it. So leave an empty slot instead of swapping the last one in.
+		const Int index = coi->friend_getModuleIndex();
+		const Bool inArray = index >= 0 && index < (Int)m_modules.size() && m_modules[index].coi == coi;
+		DEBUG_ASSERTCRASH(inArray, ("module is not in the cell"));
+		if (inArray)
+		{
+			m_modules[index].module = NULL;
+			m_modules[index].coi = NULL;
+			++m_emptyModuleSlots;
+			compactModules();
+		}
+		coi->friend_setModuleIndex(-1);
+#ifdef FASTER_GCO
+		if (ThePartitionManager)
+			ThePartitionManager->friend_invalidateGcoCache(m_cellX, m_cellY);
+#endif
 	}
 }
 
+//-----------------------------------------------------------------------------
+void PartitionCell::compactModules()
+{
+	while (!m_modules.empty() && m_modules.back().module == NULL)
+	{
+		m_modules.pop_back();
+		--m_emptyModuleSlots;
+	}
+
+	// squeeze out the empty slots once they are the majority, so that removal stays O(1) on average.
+	if (m_emptyModuleSlots * 2 <= (Int)m_modules.size())
+		return;
+
+	Int count = 0;
+	for (ModuleSlotVec::iterator it = m_modules.begin(); it != m_modules.end(); ++it)
+	{
+		if (it->module == NULL)
+			continue;
+		it->coi->friend_setModuleIndex(count);
+		m_modules[count++] = *it;
+	}
+	m_modules.resize(count);
+	m_emptyModuleSlots = 0;
+}
+
 //-----------------------------------------------------------------------------
 void PartitionCell::getCellCenterPos(Real& x, Real& y)
 {
@@ -1556,6 +1681,9 @@ PartitionData::PartitionData()
 	m_coiArray = NULL;
 	m_coiInUseCount = 0;
 	m_doneFlag = 0;
+#ifdef FASTER_GCO
+	m_positionSlot = -1;
+#endif
 	m_dirtyStatus = NOT_DIRTY;
 	m_lastCell = NULL;
 	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
@@ -1579,6 +1707,10 @@ PartitionData::~PartitionData()
 		ThePartitionManager->removeFromDirtyModules(this);
 		//DEBUG_ASSERTCRASH(!ThePartitionManager->isInListDirtyModules(this), ("hmm"));
 	}
+#ifdef FASTER_GCO
+	if (ThePartitionManager && m_positionSlot >= 0)
+		ThePartitionManager->friend_freePositionSlot(m_positionSlot);
+#endif
 } 
 
 //-----------------------------------------------------------------------------
@@ -2225,6 +2357,19 @@ void PartitionData::makeDirty(Bool needToUpdateCells)
 	}
 }
 
+//-----------------------------------------------------------------------------
+#ifdef FASTER_GCO
+void PartitionData::friend_invalidateGcoCacheOfTouchedCells()
+{
+	for (Int i = 0; i < m_coiInUseCount; ++i)
+	{
+		PartitionCell *cell = m_coiArray[i].getCell();
+		if (cell)
+			ThePartitionManager->friend_invalidateGcoCache(cell->getCellX(), cell->getCellY());
+	}
+}
+#endif
+
 //-----------------------------------------------------------------------------
 void PartitionData::allocCoiArray()
 {
@@ -2246,6 +2391,15 @@ void PartitionData::freeCoiArray()
 	makeDirty(true);
 }
 
+//-----------------------------------------------------------------------------
+void PartitionData::updatePosition()
+{
+#ifdef FASTER_GCO
+	if (m_object && m_positionSlot >= 0)
+		ThePartitionManager->friend_setObjectPosition(m_positionSlot, m_object->getPosition());
+#endif
+}
+
 //-----------------------------------------------------------------------------
 void PartitionData::attachToObject(Object* object)
 {
@@ -2253,6 +2407,12 @@ void PartitionData::attachToObject(Object* object)
 	// remember who contains us
 	m_object = object;
 
+#ifdef FASTER_GCO
+	if (m_positionSlot < 0)
+		m_positionSlot = ThePartitionManager->friend_allocPositionSlot();
+	updatePosition();
+#endif
+
 	// we only snapshot things that are immobile and have something to draw.  Don't need ghostobjects for others.
 	if (object->isKindOf(KINDOF_IMMOBILE))
 	{	const ThingTemplate *tmplate=object->getTemplate();
@@ -2572,6 +2732,15 @@ PartitionManager::PartitionManager()
 	m_updatedSinceLastReset = false;
 #ifdef FASTER_GCO
 	m_maxGcoRadius = 0;
+	m_gcoCacheVersion = 1;
+	m_gcoChangeStamp = 0;
+	m_gcoBlockCountX = 0;
+	m_gcoCacheLookups = 0;
+	m_gcoCacheHits = 0;
+	m_gcoCacheLookupsLastFrame = 0;
+	m_gcoCacheHitsLastFrame = 0;
+	m_gcoCacheLookupsTotal = 0;
+	m_gcoCacheHitsTotal = 0;
 #endif
 } 
 
@@ -2649,8 +2818,13 @@ void PartitionManager::init()
 
 #ifdef FASTER_GCO
 		calcRadiusVec();
+		m_gcoCellCaches.resize(m_totalCellCount);
+		m_gcoBlockCountX = (m_cellCountX + (1 << GCO_CACHE_BLOCK_SHIFT) - 1) >> GCO_CACHE_BLOCK_SHIFT;
+		m_gcoBlockChangeStamps.assign(m_gcoBlockCountX * ((m_cellCountY + (1 << GCO_CACHE_BLOCK_SHIFT) - 1) >> GCO_CACHE_BLOCK_SHIFT), m_gcoChangeStamp);
 #endif
 
+		m_cellCRCCache.reset((m_totalCellCount + CELLS_PER_CRC_SEGMENT - 1) / CELLS_PER_CRC_SEGMENT);
+
 	}
 	else
 	{
@@ -2666,7 +2840,7 @@ void PartitionManager::init()
 
 //-----------------------------------------------------------------------------
 #ifdef DUMP_PERF_STATS
-void PartitionManager::getPMStats(double& gcoTimeThisFrameTotal, double& gcoTimeThisFrameAvg)
+void PartitionManager::getPMStats(double& gcoTimeThisFrameTotal, double& gcoTimeThisFrameAvg, double& gcoCacheHitRate)
 {
 	Int64 freq64;
 	GetPrecisionTimerTicksPerSec(&freq64);
@@ -2675,6 +2849,12 @@ void PartitionManager::getPMStats(double& gcoTimeThisFrameTotal, double& gcoTime
 
 	gcoTimeThisFrameTotal = gcoTimeInMSecs;
 	gcoTimeThisFrameAvg = gcoTimeInMSecs / (double)s_countInClosestObjectsThisFrame;
+
+#ifdef FASTER_GCO
+	gcoCacheHitRate = m_gcoCacheLookupsLastFrame ? (double)m_gcoCacheHitsLastFrame / (double)m_gcoCacheLookupsLastFrame : 0.0;
+#else
+	gcoCacheHitRate = 0.0;
+#endif
 }
 #endif
 
@@ -2715,12 +2895,24 @@ void PartitionManager::shutdown()
 
 #ifdef FASTER_GCO
 	m_radiusVec.clear();
+	m_gcoCellCaches.clear();
+	m_gcoBlockChangeStamps.clear();
+	++m_gcoCacheVersion;
+
+	if (m_gcoCacheLookupsTotal > 0)
+	{
+		DEBUG_LOG(("PartitionManager::shutdown - getClosestObjects cache hit %u of %u lookups (%.1f%%)", m_gcoCacheHitsTotal,
+			m_gcoCacheLookupsTotal, 100.0 * (double)m_gcoCacheHitsTotal / (double)m_gcoCacheLookupsTotal));
+	}
+	m_gcoCacheLookupsTotal = 0;
+	m_gcoCacheHitsTotal = 0;
 #endif
 
 	resetPendingUndoShroudRevealQueue();
 	
 	delete [] m_cells;
 	m_cells = NULL;
+	m_cellCRCCache.reset(0);
 
 	m_cellSize = m_cellSizeInv = 0.0f;
 	m_cellCountX = 0;
@@ -2734,7 +2926,16 @@ void PartitionManager::shutdown()
 //DECLARE_PERF_TIMER(PartitionManager_update)
 void PartitionManager::update()
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_update)
 	//USE_PERF_TIMER(PartitionManager_update)
+#ifdef FASTER_GCO
+	// the cached cell walks only live for one logic frame.
+	m_gcoCacheLookupsLastFrame = m_gcoCacheLookups;
+	m_gcoCacheHitsLastFrame = m_gcoCacheHits;
+	m_gcoCacheLookups = 0;
+	m_gcoCacheHits = 0;
+	++m_gcoCacheVersion;
+#endif
 	{
 #ifdef INTENSE_DEBUG
 		Int cc = 0;
@@ -2900,6 +3101,10 @@ void PartitionManager::unRegisterObject( Object* object )
 			TheContactList->removeSpecificPartitionData(mod);
 		object->friend_setPartitionData(NULL);
 		mod->friend_setObject(NULL);
+#ifdef FASTER_GCO
+		// the module stays in its cells, but the cached objects of these cells are stale now.
+		mod->friend_invalidateGcoCacheOfTouchedCells();
+#endif
 		//Tell the ghost object that its parent is dead.
 		ghost->updateParentObject(NULL, mod);
 		return;
@@ -3213,6 +3418,269 @@ void PartitionManager::calcRadiusVec()
 }
 #endif
 
+#ifdef FASTER_GCO
+//-----------------------------------------------------------------------------
+void PartitionManager::gatherGcoCandidates(GcoCellCache& cache, Int cellCenterX, Int cellCenterY, Int radius, Int iterFlag)
+{
+	DEBUG_ASSERTCRASH(cache.builtRadius == radius - 1, ("radii must be gathered in order"));
+
+	/*
+		m_radiusVec[radius] contains a list of the cells (foo) that could
+		contain objects that are <= (radius * cellSize) distance away from cell (0,0).
+	*/
+	const OffsetVec& offsets = m_radiusVec[radius];
+	for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+	{
+		const PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
+		if (thisCell == NULL)
+			continue;
+
+		// walk the module array backwards, which is the order of the COI list.
+		const PartitionCell::ModuleSlotVec& modules = thisCell->getModulesInCell();
+		for (PartitionCell::ModuleSlotVec::const_reverse_iterator modIt = modules.rbegin(); modIt != modules.rend(); ++modIt)
+		{
+			PartitionData *thisMod = modIt->module;
+			if (thisMod == NULL)
+				continue;
+
+			// since an object can exist in multiple COIs, we use this to avoid gathering
+			// the same one more than once.
+			if (thisMod->friend_getDoneFlag() == iterFlag)
+				continue;
+			thisMod->friend_setDoneFlag(iterFlag);
+
+			cache.candidates.push_back(thisMod);
+			cache.candidateObjects.push_back(thisMod->getObject());
+			cache.candidatePositionSlots.push_back(thisMod->getObject() ? thisMod->friend_getPositionSlot() : -1);
+		}
+	}
+
+	cache.radiusEnds.push_back((Int)cache.candidates.size());
+	cache.builtRadius = radius;
+
+	// the smaller radii were checked for changes just before, so the whole cache is current now.
+	cache.changeStamp = m_gcoChangeStamp;
+}
+
+//-----------------------------------------------------------------------------
+Bool PartitionManager::isGcoCacheChanged(const GcoCellCache& cache, Int cellCenterX, Int cellCenterY) const
+{
+	if (cache.builtRadius < 0)
+		return false;
+
+	// the cells of radius r are at most r + 1 cells away from the center in x and y.
+	const Int reach = cache.builtRadius + 1;
+	const Int loX = (cellCenterX - reach > 0 ? cellCenterX - reach : 0) >> GCO_CACHE_BLOCK_SHIFT;
+	const Int loY = (cellCenterY - reach > 0 ? cellCenterY - reach : 0) >> GCO_CACHE_BLOCK_SHIFT;
+	const Int hiX = (cellCenterX + reach < m_cellCountX - 1 ? cellCenterX + reach : m_cellCountX - 1) >> GCO_CACHE_BLOCK_SHIFT;
+	const Int hiY = (cellCenterY + reach < m_cellCountY - 1 ? cellCenterY + reach : m_cellCountY - 1) >> GCO_CACHE_BLOCK_SHIFT;
+
+	for (Int blockY = loY; blockY <= hiY; ++blockY)
+	{
+		const UnsignedInt *stamps = &m_gcoBlockChangeStamps[blockY * m_gcoBlockCountX];
+		for (Int blockX = loX; blockX <= hiX; ++blockX)
+		{
+			if (stamps[blockX] > cache.changeStamp)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+Int PartitionManager::friend_allocPositionSlot()
+{
+	ObjectPositions& positions = m_objectPositions;
+	if (!positions.freeSlots.empty())
+	{
+		const Int slot = positions.freeSlots.back();
+		positions.freeSlots.pop_back();
+		return slot;
+	}
+
+	const Int slot = (Int)positions.x.size();
+	positions.x.push_back(0.0f);
+	positions.y.push_back(0.0f);
+	positions.z.push_back(0.0f);
+	return slot;
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::friend_freePositionSlot(Int slot)
+{
+	m_objectPositions.freeSlots.push_back(slot);
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::calcGcoDistanceBatch(const Coord3D *center, Bool is3D, const Int *positionSlots, Int count, Real maxDistSqr)
+{
+	GcoDistanceBatch& batch = m_gcoDistanceBatch;
+	if ((Int)batch.distSqr.size() < count)
+	{
+		batch.x.resize(count);
+		batch.y.resize(count);
+		batch.z.resize(count);
+		batch.distSqr.resize(count);
+		batch.inRange.resize(count);
+	}
+
+	const ObjectPositions& positions = m_objectPositions;
+	for (Int i = 0; i < count; ++i)
+	{
+		// objectless entries are skipped by the caller, so any position will do for them.
+		const Int slot = positionSlots[i];
+		if (slot >= 0)
+		{
+			batch.x[i] = positions.x[slot];
+			batch.y[i] = positions.y[slot];
+			batch.z[i] = positions.z[slot];
+		}
+		else
+		{
+			batch.x[i] = center->x;
+			batch.y[i] = center->y;
+			batch.z[i] = center->z;
+		}
+	}
+
+	calcCenterDistSqrBatch(center, is3D, &batch.x[0], &batch.y[0], &batch.z[0], count, maxDistSqr, &batch.distSqr[0], &batch.inRange[0]);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+static Int64 getBenchmarkTicks()
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+//-----------------------------------------------------------------------------
+static Real randomBenchmarkReal(UnsignedInt& seed, Real range)
+{
+	seed = seed * 1664525 + 1013904223;
+	return (Real)(seed >> 8) * (range / (Real)(1 << 24));
+}
+
+//-----------------------------------------------------------------------------
+/**
+	TheSuperHackers @performance alanblack166 18/10/2026 Runs the center distance checks of getClosestObjects on random
+	positions, once with the scalar distance procs on the positions of scattered objects, and once
+	with the batch on positions gathered from per-axis arrays by their slot, like the cache does.
+	Returns 0 if both agree bit for bit on every distance and in-range flag.
+*/
+//-----------------------------------------------------------------------------
+Int PartitionManager::benchmarkDistances()
+{
+	Int64 ticksPerSecond = 1;
+	LARGE_INTEGER freq;
+	if (QueryPerformanceFrequency(&freq) && freq.QuadPart > 0)
+		ticksPerSecond = freq.QuadPart;
+
+	const Int positionCount = 64 * 1024;
+	const Int queryCount = 2048;
+	const Int candidateCount = 256;
+	const Real worldSize = 4000.0f;
+
+	UnsignedInt seed = 0x1234567;
+
+	// the objects are scattered through memory, so the scalar procs get a pointer to each position.
+	std::vector<Coord3D> objectPositions(positionCount);
+	std::vector<Real> xs(positionCount), ys(positionCount), zs(positionCount);
+	for (Int i = 0; i < positionCount; ++i)
+	{
+		objectPositions[i].x = xs[i] = randomBenchmarkReal(seed, worldSize);
+		objectPositions[i].y = ys[i] = randomBenchmarkReal(seed, worldSize);
+		objectPositions[i].z = zs[i] = randomBenchmarkReal(seed, 100.0f);
+	}
+
+	std::vector<Int> slots(candidateCount);
+	std::vector<Real> batchX(candidateCount), batchY(candidateCount), batchZ(candidateCount);
+	std::vector<Real> batchDistSqr(candidateCount), scalarDistSqr(candidateCount);
+	std::vector<UnsignedByte> batchInRange(candidateCount), scalarInRange(candidateCount);
+
+	Bool allSame = TRUE;
+	for (Int is3D = 0; is3D < 2; ++is3D)
+	{
+		DistCalcProc distProc = is3D ? distCalcProc_CenterAndCenter_3D : distCalcProc_CenterAndCenter_2D;
+		Int64 scalarTicks = 0;
+		Int64 batchTicks = 0;
+		UnsignedInt mismatchCount = 0;
+		UnsignedInt inRangeCount = 0;
+
+		for (Int query = 0; query < queryCount; ++query)
+		{
+			Coord3D center;
+			center.x = randomBenchmarkReal(seed, worldSize);
+			center.y = randomBenchmarkReal(seed, worldSize);
+			center.z = randomBenchmarkReal(seed, 100.0f);
+			const Real maxDist = randomBenchmarkReal(seed, 500.0f);
+			const Real maxDistSqr = maxDist * maxDist;
+
+			for (Int i = 0; i < candidateCount; ++i)
+				slots[i] = (Int)(randomBenchmarkReal(seed, 1.0f) * positionCount) % positionCount;
+
+			// one candidate sits exactly on the range limit, and one on the center.
+			xs[slots[0]] = objectPositions[slots[0]].x = center.x + maxDist;
+			ys[slots[0]] = objectPositions[slots[0]].y = center.y;
+			zs[slots[0]] = objectPositions[slots[0]].z = center.z;
+			xs[slots[1]] = objectPositions[slots[1]].x = center.x;
+			ys[slots[1]] = objectPositions[slots[1]].y = center.y;
+			zs[slots[1]] = objectPositions[slots[1]].z = center.z;
+
+			Int64 startTicks = getBenchmarkTicks();
+			for (Int i = 0; i < candidateCount; ++i)
+			{
+				Coord3D distVec;
+				scalarInRange[i] = (*distProc)(&center, NULL, &objectPositions[slots[i]], NULL, scalarDistSqr[i], distVec, maxDistSqr);
+			}
+			scalarTicks += getBenchmarkTicks() - startTicks;
+
+			startTicks = getBenchmarkTicks();
+			for (Int i = 0; i < candidateCount; ++i)
+			{
+				const Int slot = slots[i];
+				batchX[i] = xs[slot];
+				batchY[i] = ys[slot];
+				batchZ[i] = zs[slot];
+			}
+			calcCenterDistSqrBatch(&center, is3D != 0, &batchX[0], &batchY[0], &batchZ[0], candidateCount, maxDistSqr, &batchDistSqr[0], &batchInRange[0]);
+			batchTicks += getBenchmarkTicks() - startTicks;
+
+			for (Int i = 0; i < candidateCount; ++i)
+			{
+				if (memcmp(&batchDistSqr[i], &scalarDistSqr[i], sizeof(Real)) != 0 || (batchInRange[i] != 0) != (scalarInRange[i] != 0))
+					++mismatchCount;
+				if (scalarInRange[i])
+					++inRangeCount;
+			}
+		}
+
+		const double checkCount = (double)queryCount * (double)candidateCount;
+		const double scalarNanoseconds = (double)scalarTicks * 1.0e9 / (double)ticksPerSecond / checkCount;
+		const double batchNanoseconds = (double)batchTicks * 1.0e9 / (double)ticksPerSecond / checkCount;
+		const char *name = is3D ? "center distance 3D" : "center distance 2D";
+
+		printf("%-20s scalar %6.2f ns, batch %6.2f ns, %5.2fx, %u of %.0f in range, %u mismatches\n", name,
+			scalarNanoseconds, batchNanoseconds, batchNanoseconds > 0.0 ? scalarNanoseconds / batchNanoseconds : 0.0,
+			inRangeCount, checkCount, mismatchCount);
+		DEBUG_LOG(("PartitionManager::benchmarkDistances - %s: scalar %.2f ns, batch %.2f ns, %u mismatches", name,
+			scalarNanoseconds, batchNanoseconds, mismatchCount));
+
+		if (mismatchCount != 0)
+			allSame = FALSE;
+	}
+
+#ifdef PM_BATCH_DISTANCE_SSE
+	printf("the batch uses SSE\n");
+#else
+	printf("the batch uses the scalar fallback\n");
+#endif
+
+	return allSame ? 0 : 1;
+}
+
 //-----------------------------------------------------------------------------
 //DECLARE_PERF_TIMER(getClosestObjects)
 Object *PartitionManager::getClosestObjects(
@@ -3300,69 +3768,121 @@ Object *PartitionManager::getClosestObjects(
 	static Int theIterFlag = 1;	// nonzero, thanks
 	++theIterFlag;
 
-	/*
-		m_radiusVec[curRadius] contains a list of the cells (foo) that could
-		contain objects that are <= (curRadius * cellSize) distance away from cell (0,0).
-	*/
+	// TheSuperHackers @performance alanblack166 18/10/2026 The objects found in the cells around a cell are cached until
+	// the next logic frame or until the contents of a cell within their reach change, whichever comes
+	// first. Many updates query around the same cells in a frame, and they only need to run the distance
+	// checks and filters on the cached objects. The objects are visited in the same order as before.
+	GcoCellCache* cache = &m_gcoScratchCache;
+	Bool cacheValid = false;
+	if (maxRadiusLimit <= GCO_CACHE_MAX_RADIUS && getCellAt(cellCenterX, cellCenterY) != NULL)
+	{
+		cache = &m_gcoCellCaches[cellCenterY * m_cellCountX + cellCenterX];
+		++m_gcoCacheLookups;
+		++m_gcoCacheLookupsTotal;
+		if (cache->version == m_gcoCacheVersion && !isGcoCacheChanged(*cache, cellCenterX, cellCenterY))
+		{
+			++m_gcoCacheHits;
+			++m_gcoCacheHitsTotal;
+			cacheValid = true;
+		}
+	}
+	if (!cacheValid)
+	{
+		cache->version = m_gcoCacheVersion;
+		cache->changeStamp = m_gcoChangeStamp;
+		cache->builtRadius = -1;
+		cache->candidates.clear();
+		cache->candidateObjects.clear();
+		cache->candidatePositionSlots.clear();
+		cache->radiusEnds.clear();
+	}
+	Bool needMarkCandidates = cacheValid;
+	const Bool useDistanceBatch = (dc == FROM_CENTER_2D || dc == FROM_CENTER_3D);
+
   for (Int curRadius = 0; curRadius <= maxRadiusLimit; ++curRadius)
   {
-    const OffsetVec& offsets = m_radiusVec[curRadius];
-		if (offsets.empty())
-			continue;
-    for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+		if (cache->builtRadius < curRadius)
+		{
+			if (needMarkCandidates)
+			{
+				// the cached objects must not be gathered again at the larger radius.
+				for (std::vector<PartitionData*>::const_iterator it = cache->candidates.begin(); it != cache->candidates.end(); ++it)
+					(*it)->friend_setDoneFlag(theIterFlag);
+				needMarkCandidates = false;
+			}
+			gatherGcoCandidates(*cache, cellCenterX, cellCenterY, curRadius, theIterFlag);
+		}
+
+		const Int candidateBegin = curRadius > 0 ? cache->radiusEnds[curRadius - 1] : 0;
+		const Int candidateEnd = cache->radiusEnds[curRadius];
+
+		// the center distances of all candidates in this radius are calculated in one batch.
+		// closestDistSqr can only shrink below, so the in-range flags never reject too much.
+		if (useDistanceBatch && candidateEnd > candidateBegin)
+			calcGcoDistanceBatch(objPos, dc == FROM_CENTER_3D, &cache->candidatePositionSlots[candidateBegin], candidateEnd - candidateBegin, closestDistSqr);
+
+    for (Int candidate = candidateBegin; candidate < candidateEnd; ++candidate)
 		{
-			PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
-			if (thisCell == NULL)
+			Object *thisObj = cache->candidateObjects[candidate];
+
+			// never compare against ourself.
+			if (thisObj == obj || thisObj == NULL) 
 				continue;
 
-			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
+			Real thisDistSqr;
+			Coord3D distVec;
+			if (useDistanceBatch)
 			{
-				PartitionData *thisMod = thisCoi->getModule();
-				Object *thisObj = thisMod->getObject();
-
-				// never compare against ourself.
-				if (thisObj == obj || thisObj == NULL) 
+				const Int batchIndex = candidate - candidateBegin;
+				if (!m_gcoDistanceBatch.inRange[batchIndex])
 					continue;
 
-				// since an object can exist in multiple COIs, we use this to avoid processing
-				// the same one more than once.
-				if (thisMod->friend_getDoneFlag() == theIterFlag)
-					continue;
-				thisMod->friend_setDoneFlag(theIterFlag);
-			
-				Real thisDistSqr;
-				Coord3D distVec;
-				if (!(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, thisDistSqr, distVec, closestDistSqr))
+				thisDistSqr = m_gcoDistanceBatch.distSqr[batchIndex];
+				if (!(thisDistSqr < closestDistSqr))
 					continue;
 
-				if (!filtersAllow(filters, thisObj))
-					continue;
+				distVec.x = m_gcoDistanceBatch.x[batchIndex] - objPos->x;
+				distVec.y = m_gcoDistanceBatch.y[batchIndex] - objPos->y;
+				distVec.z = (dc == FROM_CENTER_3D) ? m_gcoDistanceBatch.z[batchIndex] - objPos->z : 0.0f;
 
-				// ok, this is within the range, and the filters allow it.
-				// add it to the iter, if we have one....
-				if (iterArg)
-				{
-					iterArg->insert(thisObj, thisDistSqr);
-				}
-				else
+#ifdef RTS_DEBUG
+				Real checkDistSqr;
+				Coord3D checkVec;
+				(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, checkDistSqr, checkVec, closestDistSqr);
+				DEBUG_ASSERTCRASH(checkDistSqr == thisDistSqr, ("batched distance %f differs from %f", thisDistSqr, checkDistSqr));
+#endif
+			}
+			else if (!(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, thisDistSqr, distVec, closestDistSqr))
+			{
+				continue;
+			}
+
+			if (!filtersAllow(filters, thisObj))
+				continue;
+
+			// ok, this is within the range, and the filters allow it.
+			// add it to the iter, if we have one....
+			if (iterArg)
+			{
+				iterArg->insert(thisObj, thisDistSqr);
+			}
+			else
+			{
+				// hey, this is the new closest object! cool.
+				// (note that we can't break out now 'cuz we have to finish examining the
+				// rest of curRadius)
+				closestObj = thisObj;
+				closestDistSqr = thisDistSqr;
+				closestVec = distVec;
+
+				if (!foundAny)
 				{
-					// hey, this is the new closest object! cool.
-					// (note that we can't break out now 'cuz we have to finish examining the
-					// rest of curRadius)
-					closestObj = thisObj;
-					closestDistSqr = thisDistSqr;
-					closestVec = distVec;
-
-					if (!foundAny)
-					{
-						// if not adding to iterArg, we want to stop once we have the closest object. 
-						maxRadiusLimit = curRadius;
-					}
-					foundAny = true;
+					// if not adding to iterArg, we want to stop once we have the closest object. 
+					maxRadiusLimit = curRadius;
 				}
-
-			} // next coi
-		}	// next cell in this radius
+				foundAny = true;
+			}
+		}	// next object in this radius
   } // next radius
 
 #else // not FASTER_GCO
@@ -3475,6 +3995,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_getClosestObject)
 	return getClosestObjects(obj, NULL, maxDist, dc, filters, NULL, closestDist, closestDistVec);
 }
 
@@ -3488,6 +4009,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_getClosestObject)
 	return getClosestObjects(NULL, pos, maxDist, dc, filters, NULL, closestDist, closestDistVec);
 }
 
@@ -3621,6 +4143,7 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	IterOrderType order
 )
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_iterateObjectsInRange)
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3641,6 +4164,7 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	IterOrderType order
 )
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_iterateObjectsInRange)
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3660,6 +4184,7 @@ SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
 	Bool use2D
 )
 {	
+	LOGIC_PROFILE_SCOPE(PartitionManager_iteratePotentialCollisions)
 	Real maxDist = geom.getBoundingSphereRadius();
 	maxDist *= 1.1f;	// just a little slop
 
@@ -3702,6 +4227,7 @@ Bool PartitionManager::isColliding( const Object *a, const Object *b ) const
 //-----------------------------------------------------------------------------
 SimpleObjectIterator *PartitionManager::iterateAllObjects(PartitionFilter **filters)
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_iterateAllObjects)
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3907,6 +4433,7 @@ Bool PartitionManager::findPositionAround( const Coord3D *center,
 																					 const FindPositionOptions *options, 
 																					 Coord3D *result )
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_findPositionAround)
 
 	// sanity
 	if( center == NULL || result == NULL || options == NULL )
@@ -4514,6 +5041,7 @@ static Real calcDist2D(Real x1, Real y1, Real x2, Real y2)
 //-----------------------------------------------------------------------------
 Bool PartitionManager::isClearLineOfSightTerrain(const Object* obj, const Coord3D& objPos, const Object* other, const Coord3D& otherPos)
 {
+	LOGIC_PROFILE_SCOPE(PartitionManager_isClearLineOfSightTerrain)
 	Coord3D pos, posOther;
 	
 	if (obj)
@@ -4592,6 +5120,14 @@ Bool PartitionManager::isClearLineOfSightTerrain(const Object* obj, const Coord3
 void PartitionManager::crc( Xfer *xfer )
 {
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 The cell shroud rarely changes, so the light CRC reuses the
+	// cached CRC data of unchanged cells. The deep CRC walks all cells.
+	if (xfer->getXferMode() == XFER_CRC)
+	{
+		m_cellCRCCache.crc((XferCRC *)xfer, crcCellSegment, this);
+		return;
+	}
+
 	for (Int i=0; i<m_totalCellCount; ++i)
 	{
 		m_cells[i].crc(xfer);
@@ -4599,6 +5135,20 @@ void PartitionManager::crc( Xfer *xfer )
 
 }  // end crc
 
+// ------------------------------------------------------------------------------------------------
+/** CRC the cells of one segment of m_cellCRCCache */
+// ------------------------------------------------------------------------------------------------
+void PartitionManager::crcCellSegment( Xfer *xfer, Int segment, void *userData )
+{
+	PartitionManager *self = (PartitionManager *)userData;
+	const Int begin = segment * CELLS_PER_CRC_SEGMENT;
+	const Int end = min(begin + (Int)CELLS_PER_CRC_SEGMENT, self->m_totalCellCount);
+	for (Int i = begin; i < end; ++i)
+	{
+		self->m_cells[i].crc(xfer);
+	}
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Xfer Method
 	* Version Info:
@@ -4665,6 +5215,9 @@ void PartitionManager::xfer( Xfer *xfer )
 		// tell partition manager to re-evaluate shroud things when next asked
 		m_updatedSinceLastReset = FALSE;
 
+		// the loaded shroud is not in the cached CRC data
+		m_cellCRCCache.markAllDirty();
+
 		// refresh the shroud for the local player which will update the radar and everything
 		refreshShroudForLocalPlayer();
 
@@ -912,6 +912,7 @@ m_hard(true),
 m_delayEvaluationSeconds(0),
 m_conditionTime(0),
 m_conditionExecutedCount(0),
+m_conditionSleepSerial(0),
 m_frameToEvaluateAt(0),
 m_isSubroutine(false),
 m_hasWarnings(false),
@@ -1839,6 +1840,7 @@ void Parameter::qualify(const AsciiString& qualifier,
 		case SCRIPT_SUBROUTINE: m_string.concat(qualifier); break;
 		default: break;
 	}
+	m_bindingGeneration = 0;
 }
 
 AsciiString Parameter::getUiText(void) const
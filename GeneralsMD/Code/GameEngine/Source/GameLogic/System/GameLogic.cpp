@@ -31,6 +31,7 @@
 
 #include "Common/AudioAffect.h"
 #include "Common/AudioHandleSpecialValues.h"
+#include "Common/ArchiveFileSystem.h"
 #include "Common/BuildAssistant.h"
 #include "Common/CRCDebug.h"
 #include "Common/GameAudio.h"
@@ -39,6 +40,7 @@
 #include "Common/GameState.h"
 #include "Common/INI.h"
 #include "Common/LatchRestore.h"
+#include "Common/LogicProfiler.h"
 #include "Common/MapObject.h"
 #include "Common/MultiplayerSettings.h"
 #include "Common/PerfTimer.h"
@@ -275,9 +277,9 @@ void GameLogic::setDefaults( Bool loadingSaveGame )
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	m_normalUpdates.clear();
 #endif
-	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	for (std::vector<SleepyUpdateEntry>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
-		(*it)->friend_setIndexInLogic(-1);
+		it->update->friend_setIndexInLogic(-1);
 	}
 	m_sleepyUpdates.clear();
 	m_curUpdateModule = NULL;
@@ -1133,6 +1135,8 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	__int64 endTime64,freq64;
 	GetPrecisionTimerTicksPerSec(&freq64);
 	GetPrecisionTimer(&startTime64);
+	if (TheArchiveFileSystem)
+		TheArchiveFileSystem->resetLookupCount();
 	#endif
 
 	// reset the frame counter
@@ -2395,6 +2399,14 @@ void GameLogic::startNewGame( Bool loadingSaveGame )
 	GetPrecisionTimer(&endTime64);
 	sprintf(Buf,"Total startnewgame=%f",((double)(endTime64-startTime64)/(double)(freq64)*1000.0));
 	DEBUG_LOG(("%s", Buf));
+	if (TheArchiveFileSystem)
+	{
+		// TheSuperHackers @performance alanblack166 18/10/2026 The number of archive file lookups that the map load made.
+		const UnsignedInt lookups = TheArchiveFileSystem->getLookupCount();
+		const double loadSeconds = (double)(endTime64-startTime64)/(double)(freq64);
+		sprintf(Buf,"Archive file lookups=%u (%f per second of load time)",lookups,loadSeconds > 0.0 ? lookups/loadSeconds : 0.0);
+		DEBUG_LOG(("%s", Buf));
+	}
 #endif
 
 	//Assume that getting this far means we've successfully entered an online game.
@@ -2507,10 +2519,10 @@ void GameLogic::loadMapINI( AsciiString mapName )
  * see each other at each simulation frame - the object list is the
  * same at the start of the update as it is at the end of the update. */
 // ------------------------------------------------------------------------------------------------
-//DECLARE_PERF_TIMER(processDestroyList)
+DECLARE_PERF_TIMER(processDestroyList)
 void GameLogic::processDestroyList( void )
 {
-	//USE_PERF_TIMER(processDestroyList)
+	USE_PERF_TIMER(processDestroyList)
 
 	for( ObjectPointerListIterator iterator = m_objectsToDestroy.begin(); iterator != m_objectsToDestroy.end(); iterator++ )
 	{
@@ -2545,20 +2557,35 @@ void GameLogic::processDestroyList( void )
 		UpdateModulePtr sleepyUpdatesForThisObject[MAX_SUO];
 		Int numSUO = 0;
 
-		for (std::vector<UpdateModulePtr>::iterator it2 = m_sleepyUpdates.begin(); it2 != m_sleepyUpdates.end(); ++it2)
+		// TheSuperHackers @performance alanblack166 18/10/2026 Find the sleepy updates through the behavior modules of the object
+		// and their heap indices, instead of scanning the whole heap for every destroyed object.
+		// They are sorted by heap index so that they are erased in the same order as before,
+		// which keeps the heap layout and therefore the update order identical.
+		for (BehaviorModule** b = currentObject->getBehaviorModules(); *b; ++b)
 		{
-			UpdateModulePtr u = *it2;
-			if (u->friend_getObject() == currentObject && numSUO < MAX_SUO)
+#ifdef DIRECT_UPDATEMODULE_ACCESS
+			UpdateModulePtr u = (UpdateModulePtr)((*b)->getUpdate());
+#else
+			UpdateModulePtr u = (*b)->getUpdate();
+#endif
+			if (!u || u->friend_getIndexInLogic() < 0 || numSUO >= MAX_SUO)
+				continue;
+
+			DEBUG_ASSERTCRASH(m_sleepyUpdates[u->friend_getIndexInLogic()].update == u, ("Hmm, expected update mismatch here"));
+
+			Int i = numSUO++;
+			for (; i > 0 && sleepyUpdatesForThisObject[i-1]->friend_getIndexInLogic() > u->friend_getIndexInLogic(); --i)
 			{
-				sleepyUpdatesForThisObject[numSUO++] = u;
+				sleepyUpdatesForThisObject[i] = sleepyUpdatesForThisObject[i-1];
 			}
+			sleepyUpdatesForThisObject[i] = u;
 		}
 
 		for (--numSUO; numSUO >= 0; --numSUO)
 		{
 			// have to re-get idx each time since each call to erase might change others.
 			Int idx = sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic();
-			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx] == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
+			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx].update == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
 			eraseSleepyUpdate(idx);
 			DEBUG_ASSERTCRASH(sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic() == -1, ("Hmm, expected index to be -1 here"));
 		}
@@ -2785,28 +2812,29 @@ inline void GameLogic::validateSleepyUpdate() const
 	//DEBUG_LOG(("\n"));
 	//for (i = 0; i < sz; ++i)
 	//{
-	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i],m_sleepyUpdates[i]->friend_getNextCallFrame()));
+	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i].update,m_sleepyUpdates[i].update->friend_getNextCallFrame()));
 	//}
 	for (i = 0; i < sz; ++i)
 	{
-		DEBUG_ASSERTCRASH(m_sleepyUpdates[i]->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i]->friend_getIndexInLogic()));
-		UnsignedInt pri = m_sleepyUpdates[i]->friend_getPriority();
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i].update->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i].update->friend_getIndexInLogic()));
+		UnsignedInt pri = m_sleepyUpdates[i].priority;
+		DEBUG_ASSERTCRASH(pri == m_sleepyUpdates[i].update->friend_getPriority(), ("sleepyUpdates priority is stale"));
 		if (i > 0)
 		{
 			Int i0 = (i+1)/2-1;
-			UnsignedInt pri0 = m_sleepyUpdates[i0]->friend_getPriority();
+			UnsignedInt pri0 = m_sleepyUpdates[i0].priority;
 			DEBUG_ASSERTCRASH(pri >= pri0, ("sleepyUpdates are munged (0)"));
 		}
 		Int i1 = 2*(i+1)-1;
 		Int i2 = 2*(i+1);
 		if (i1 < sz)
 		{
-			UnsignedInt pri1 = m_sleepyUpdates[i1]->friend_getPriority();
+			UnsignedInt pri1 = m_sleepyUpdates[i1].priority;
 			DEBUG_ASSERTCRASH(pri <= pri1, ("sleepyUpdates are munged (1)"));
 		}
 		if (i2 < sz)
 		{
-			UnsignedInt pri2 = m_sleepyUpdates[i2]->friend_getPriority();
+			UnsignedInt pri2 = m_sleepyUpdates[i2].priority;
 			DEBUG_ASSERTCRASH(pri <= pri2, ("sleepyUpdates are munged (2)"));
 		}
 	}
@@ -2821,13 +2849,13 @@ void GameLogic::eraseSleepyUpdate(Int i)
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
 	// swap with the final item, toss the final item, then rebalance
-	m_sleepyUpdates[i]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[i].update->friend_setIndexInLogic(-1);
 
 	Int final = m_sleepyUpdates.size() - 1;
 	if (i < final)
 	{
 		m_sleepyUpdates[i] = m_sleepyUpdates[final];
-		m_sleepyUpdates[i]->friend_setIndexInLogic(i);
+		m_sleepyUpdates[i].update->friend_setIndexInLogic(i);
 		m_sleepyUpdates.pop_back();
 		rebalanceSleepyUpdate(i);
 	}
@@ -2838,15 +2866,13 @@ void GameLogic::eraseSleepyUpdate(Int i)
 }
 
 // ------------------------------------------------------------------------------------------------
-inline Bool isLowerPriority(const UpdateModulePtr a, const UpdateModulePtr b)
+inline Bool isLowerPriority(const GameLogic::SleepyUpdateEntry& a, const GameLogic::SleepyUpdateEntry& b)
 {
 	// return true iff a is lower pri than b.
 	// remember: lower ordinal value means higher priority.
 	// therefore, higher ordinal value means lower priority.
-	DEBUG_ASSERTCRASH(a && b, ("these may no longer be null"));
-	UnsignedInt f1 = a->friend_getPriority();
-	UnsignedInt f2 = b->friend_getPriority();
-	return f1 > f2;
+	DEBUG_ASSERTCRASH(a.update && b.update, ("these may no longer be null"));
+	return a.priority > b.priority;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -2856,22 +2882,23 @@ Int GameLogic::rebalanceParentSleepyUpdate(Int i)
 
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
+	// TheSuperHackers @performance alanblack166 18/10/2026 Move the parents down into the hole and place the entry once at
+	// the end, instead of swapping at every level. This yields the same heap layout as swapping.
+	const SleepyUpdateEntry entry = m_sleepyUpdates[i];
+
 	Int parent = ((i+1)>>1)-1;
-	while (parent >= 0 && isLowerPriority(m_sleepyUpdates[parent], m_sleepyUpdates[i]))
+	while (parent >= 0 && isLowerPriority(m_sleepyUpdates[parent], entry))
 	{
-		UpdateModulePtr a = m_sleepyUpdates[parent];
-		UpdateModulePtr b = m_sleepyUpdates[i];
-
-		m_sleepyUpdates[i] = a;
-		m_sleepyUpdates[parent] = b;
-
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(parent);
+		m_sleepyUpdates[i] = m_sleepyUpdates[parent];
+		m_sleepyUpdates[i].update->friend_setIndexInLogic(i);
 
 		i = parent;
 		parent = ((parent+1)>>1)-1;
 	}
 
+	m_sleepyUpdates[i] = entry;
+	entry.update->friend_setIndexInLogic(i);
+
 	return i;
 }
 
@@ -2886,45 +2913,44 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 // balance down, not up), so this one is hand-unrolled for
 // max efficiency. I have left the pristine non-unrolled
 // version present for clarity. (Yes, this is worth doing.) (srj) 
+//
+// TheSuperHackers @performance alanblack166 18/10/2026 The priorities are stored in the heap, so the comparisons do not
+// need to touch the update modules. The children are moved up into the hole and the entry is
+// placed once at the end, which yields the same heap layout as swapping at every level.
 #if 1
-	UpdateModulePtr* pI = &m_sleepyUpdates[i];
-
 	// our children are i*2 and i*2+1
   Int child = ((i)<<1)+1;
-	UpdateModulePtr* pChild = &m_sleepyUpdates[0] + child;
-	UpdateModulePtr* pSZ = &m_sleepyUpdates[0] + m_sleepyUpdates.size();	// yes, this is off the end.
+	const Int sz = m_sleepyUpdates.size();
+	if (child >= sz)
+		return i;
 
-  while (pChild < pSZ) 
+	SleepyUpdateEntry* pHeap = &m_sleepyUpdates[0];
+	const SleepyUpdateEntry entry = pHeap[i];
+
+  while (child < sz) 
 	{
 		// choose the higher-priority of the two children; we must be higher-pri than that.
-		if (pChild < pSZ-1 && isLowerPriority(*pChild, *(pChild+1)))
+		if (child < sz-1 && pHeap[child].priority > pHeap[child+1].priority)
 		{
-      ++pChild;
 			++child;
 		}
 
 		// if we're higher-pri than our children, we're done.
-		if (!isLowerPriority(*pI, *pChild))
+		if (!(entry.priority > pHeap[child].priority))
 		{
 			break;
 		}
 
-		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = *pChild;
-		UpdateModulePtr b = *pI;
-
-		*pI = a;
-		*pChild = b;
-
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		// doh. move up the highest-pri child we have.
+		pHeap[i] = pHeap[child];
+		pHeap[i].update->friend_setIndexInLogic(i);
 
 		i = child;
-		pI = pChild;
-
 		child = ((i)<<1)+1;
-		pChild = &m_sleepyUpdates[0] + child;
   }
+
+	pHeap[i] = entry;
+	entry.update->friend_setIndexInLogic(i);
 #else
 	// our children are i*2 and i*2+1
 	Int sz = m_sleepyUpdates.size();
@@ -2942,14 +2968,14 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 		}
 
 		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = m_sleepyUpdates[child];
-		UpdateModulePtr b = m_sleepyUpdates[i];
+		SleepyUpdateEntry a = m_sleepyUpdates[child];
+		SleepyUpdateEntry b = m_sleepyUpdates[i];
 
 		m_sleepyUpdates[i] = a;
 		m_sleepyUpdates[child] = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		a.update->friend_setIndexInLogic(i);
+		b.update->friend_setIndexInLogic(child);
 		i = child;
 		child = ((i)<<1)+1;
   }
@@ -2962,6 +2988,9 @@ void GameLogic::rebalanceSleepyUpdate(Int i)
 {
 	USE_PERF_TIMER(SleepyMaintenance)
 
+	// the wake frame of this update may have changed, so refresh the stored priority first.
+	m_sleepyUpdates[i].priority = m_sleepyUpdates[i].update->friend_getPriority();
+
 	i = rebalanceParentSleepyUpdate(i);
 	i = rebalanceChildSleepyUpdate(i);
 }
@@ -2990,7 +3019,10 @@ void GameLogic::pushSleepyUpdate(UpdateModulePtr u)
 
 	DEBUG_ASSERTCRASH(u != NULL, ("You may not pass null for sleepy update info"));
 
-	m_sleepyUpdates.push_back(u);
+	SleepyUpdateEntry entry;
+	entry.priority = u->friend_getPriority();
+	entry.update = u;
+	m_sleepyUpdates.push_back(entry);
 	u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 	
 	rebalanceParentSleepyUpdate(m_sleepyUpdates.size()-1);
@@ -3001,7 +3033,7 @@ UpdateModulePtr GameLogic::peekSleepyUpdate() const
 {
 	USE_PERF_TIMER(SleepyMaintenance)
 
-	UpdateModulePtr u = m_sleepyUpdates.front();
+	UpdateModulePtr u = m_sleepyUpdates.front().update;
 	DEBUG_ASSERTCRASH(u->friend_getIndexInLogic() == 0, ("index mismatch: expected %d, got %d",0,u->friend_getIndexInLogic()));
 	return u;
 }
@@ -3018,11 +3050,11 @@ void GameLogic::popSleepyUpdate()
 		return;
 	}
 
-	m_sleepyUpdates[0]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[0].update->friend_setIndexInLogic(-1);
 	if (sz > 1)
 	{
 		m_sleepyUpdates[0] = m_sleepyUpdates[sz-1];
-		m_sleepyUpdates[0]->friend_setIndexInLogic(0);
+		m_sleepyUpdates[0].update->friend_setIndexInLogic(0);
 		m_sleepyUpdates.pop_back();
 		rebalanceChildSleepyUpdate(0);
 	}
@@ -3070,7 +3102,7 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 			return;
 		}
 
-		if (m_sleepyUpdates[idx] != u)
+		if (m_sleepyUpdates[idx].update != u)
 		{
 			RELEASE_CRASH("fatal error! sleepy update module index mismatch.");
 			return;
@@ -3675,9 +3707,15 @@ void GameLogic::update( void )
 	UnsignedInt now = TheGameLogic->getFrame();
 	TheGameClient->setFrame(now);
 
+	LogicProfilerFrame profilerFrame(now);
+
 	// update (execute) scripts
 	{
-		TheScriptEngine->UPDATE();
+		LOGIC_PROFILE_SCOPE(ScriptEngine_update)
+		if (TheGlobalData->m_benchmarkScriptFrames > 0)
+			TheScriptEngine->updateBenchmark();
+		else
+			TheScriptEngine->UPDATE();
 	}
 
 	Bool freezeTime = TheTacticalView->isTimeFrozen() && !TheTacticalView->isCameraMovementFinished();
@@ -3699,6 +3737,7 @@ void GameLogic::update( void )
 	// Note - TerrainLogic update needs to happen after ScriptEngine update, but before object updates.  jba.
 	// This way changes in bridges are noted in the script engine before being cleared in TerrainLogic->update
 	{
+		LOGIC_PROFILE_SCOPE(TerrainLogic_update)
 		TheTerrainLogic->UPDATE();
 	}
 
@@ -3716,6 +3755,7 @@ void GameLogic::update( void )
 
 	if (generateForSolo || generateForMP)
 	{
+		LOGIC_PROFILE_SCOPE(GameLogic_getCRC)
 		m_CRC = getCRC( CRC_RECALC );
 		bool isPlayback = (TheRecorder && TheRecorder->isPlaybackMode());
 		
@@ -3747,6 +3787,7 @@ void GameLogic::update( void )
 
 	// process client commands
 	{
+		LOGIC_PROFILE_SCOPE(GameLogic_processCommandList)
 		processCommandList( TheCommandList );
 	}
 
@@ -3759,6 +3800,7 @@ void GameLogic::update( void )
 			if (!dis.any() || dis.anyIntersectionWith(u->getDisabledTypesToProcess()))
 			{
 				USE_PERF_TIMER(GameLogic_update_normal)
+				LOGIC_PROFILE_MODULE(u)
 
 				m_curUpdateModule = u;
 
@@ -3799,6 +3841,7 @@ void GameLogic::update( void )
 			if (!dis.any() || dis.anyIntersectionWith(u->getDisabledTypesToProcess()))
 			{
 				USE_PERF_TIMER(GameLogic_update_sleepy)
+				LOGIC_PROFILE_MODULE(u)
 
 				//DEBUG_LOG(("calling update %08lx (%d %d)...",update,update->friend_getNextCallFrame(),update->friend_getNextCallPhase()));
 				m_curUpdateModule = u;
@@ -3822,11 +3865,13 @@ void GameLogic::update( void )
 
 	// update the Artificial Intelligence system
 	{
+		LOGIC_PROFILE_SCOPE(AI_update)
 		TheAI->UPDATE();
 	}
 
 	// production updates
 	{
+		LOGIC_PROFILE_SCOPE(BuildAssistant_update)
 		TheBuildAssistant->UPDATE();
 	}
 
@@ -3840,7 +3885,10 @@ void GameLogic::update( void )
 	//
 
 	// destroy all pending objects
-	processDestroyList();
+	{
+		LOGIC_PROFILE_SCOPE(GameLogic_processDestroyList)
+		processDestroyList();
+	}
 
 	// reset the command list, destroying all messages
 	TheCommandList->reset();
@@ -5164,9 +5212,9 @@ void GameLogic::loadPostProcess( void )
 			m_nextObjID = (ObjectID)((UnsignedInt)obj->getID() + 1);
 
 	// blow away the sleepy update and normal update module lists
-	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	for (std::vector<SleepyUpdateEntry>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
-		(*it)->friend_setIndexInLogic(-1);
+		it->update->friend_setIndexInLogic(-1);
 	}
 	m_sleepyUpdates.clear();
 #ifdef ALLOW_NONSLEEPY_UPDATES
@@ -5210,7 +5258,10 @@ void GameLogic::loadPostProcess( void )
 				u->friend_setNextCallFrame(now);
 #endif
 			{
-				m_sleepyUpdates.push_back(u);
+				SleepyUpdateEntry entry;
+				entry.priority = u->friend_getPriority();
+				entry.update = u;
+				m_sleepyUpdates.push_back(entry);
 				u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 			}
 				